@@ -11,6 +11,9 @@
 
 namespace El
 {
+
+template<typename T> class RedistPlan;
+
 namespace copy
 {
 
@@ -169,6 +172,26 @@ void Helper
     }
 }
 
+// The plan of the last element-wise redistribution over A's grid, rebuilt
+// whenever the shapes or distributions change. Every process of the grid
+// issues the same sequence of redistributions, so they agree on whether the
+// cached plan matches.
+template<typename T>
+RedistPlan<T>& CachedRedistPlan
+(const ElementalMatrix<T>& A, const ElementalMatrix<T>& B)
+{
+    EL_DEBUG_CSE
+    auto& cached = A.Grid().CachedRedistPlan(typeid(T));
+    auto plan = static_cast<RedistPlan<T>*>(cached.get());
+    if (plan == nullptr || !plan->Matches(A, B))
+    {
+        auto newPlan = std::make_shared<RedistPlan<T>>(A, B);
+        plan = newPlan.get();
+        cached = std::move(newPlan);
+    }
+    return *plan;
+}
+
 template<typename S,typename T,typename>
 void GeneralPurpose
 (const AbstractDistMatrix<S>& A,
@@ -231,6 +254,20 @@ void GeneralPurpose
     }
 #endif
 
+    // Within one grid, the exchange is planned (and the plan reused across
+    // repeated redistributions of the same shapes) so that only the values
+    // are sent rather than (row,column,value) triplets
+    if (A.Wrap() == ELEMENT && B.Wrap() == ELEMENT &&
+        A.GetLocalDevice() == Device::CPU &&
+        B.GetLocalDevice() == Device::CPU &&
+        A.Grid() == B.Grid())
+    {
+        const auto& AElem = static_cast<const ElementalMatrix<T>&>(A);
+        auto& BElem = static_cast<ElementalMatrix<T>&>(B);
+        CachedRedistPlan(AElem, BElem).Apply(AElem, BElem);
+        return;
+    }
+
     Helper(A, B);
 }
 
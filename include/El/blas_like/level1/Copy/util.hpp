@@ -109,6 +109,66 @@ void ColStridedUnpack(
 
 // End of DisableIf overload set
 
+// CPU packing kernels
+// ===================
+// The packing routines below are memory bound, so they copy each column
+// (or block of a column) with a single, vectorizable loop and spread the
+// columns over threads once there are enough entries to pay for the fork.
+
+// The number of entries below which a copy is left to a single thread
+constexpr Int minParallelPackSize = 1 << 14;
+// The number of entries of a column copied by a single task, so that tall,
+// narrow matrices are also spread over threads
+constexpr Int packBlockHeight = 1 << 12;
+
+// Call body(t) for each t in [0,n), where the calls copy numEntries entries
+// in total
+template <typename Body>
+void PackFor(Int n, Int numEntries, Body const& body)
+{
+    if (numEntries >= minParallelPackSize)
+    {
+        EL_PARALLEL_FOR
+        for (Int t=0; t<n; ++t)
+            body(t);
+    }
+    else
+    {
+        for (Int t=0; t<n; ++t)
+            body(t);
+    }
+}
+
+// dest[i*destStride] := source[i*sourceStride] for i in [0,numEntries)
+template <typename T>
+void StridedVectorCopy(
+    T* EL_RESTRICT dest, Int destStride,
+    T const* EL_RESTRICT source, Int sourceStride, Int numEntries)
+{
+    if (destStride == 1 && sourceStride == 1)
+    {
+        MemCopy(dest, source, numEntries);
+    }
+    else if (destStride == 1)
+    {
+        EL_SIMD
+        for (Int i=0; i<numEntries; ++i)
+            dest[i] = source[i*sourceStride];
+    }
+    else if (sourceStride == 1)
+    {
+        EL_SIMD
+        for (Int i=0; i<numEntries; ++i)
+            dest[i*destStride] = source[i];
+    }
+    else
+    {
+        EL_SIMD
+        for (Int i=0; i<numEntries; ++i)
+            dest[i*destStride] = source[i*sourceStride];
+    }
+}
+
 template <typename T,
           typename=EnableIf<IsStorageType<T,Device::CPU>>>
 void DeviceStridedMemCopy(
@@ -125,24 +185,28 @@ void InterleaveMatrix(
     T const* A, Int colStrideA, Int rowStrideA,
     T* B, Int colStrideB, Int rowStrideB, SyncInfo<Device::CPU>)
 {
-    if (colStrideA == 1 && colStrideB == 1)
-    {
-        lapack::Copy('F', height, width, A, rowStrideA, B, rowStrideB);
-    }
-    else
-    {
 #ifdef HYDROGEN_HAVE_MKL
+    if (colStrideA != 1 || colStrideB != 1)
+    {
         mkl::omatcopy(
             NORMAL, height, width, T(1.0),
             A, rowStrideA, colStrideA,
             B, rowStrideB, colStrideB);
-#else
-        for(Int j=0; j<width; ++j)
-            StridedMemCopy(
-                &B[j*rowStrideB], colStrideB,
-                &A[j*rowStrideA], colStrideA, height);
-#endif
+        return;
     }
+#endif
+    const Int numRowBlocks = (height+packBlockHeight-1) / packBlockHeight;
+    PackFor(
+        numRowBlocks*width, height*width,
+        [&](Int block)
+        {
+            const Int j = block / numRowBlocks;
+            const Int i = (block-j*numRowBlocks)*packBlockHeight;
+            StridedVectorCopy(
+                &B[i*colStrideB+j*rowStrideB], colStrideB,
+                &A[i*colStrideA+j*rowStrideA], colStrideA,
+                Min(packBlockHeight,height-i));
+        });
 }
 
 template <typename T, typename>
@@ -153,15 +217,20 @@ void RowStridedPack(
     T* BPortions, Int portionSize,
     SyncInfo<Device::CPU>)
 {
-    for (Int k=0; k<rowStride; ++k)
-    {
-        const Int rowShift = Shift_(k, rowAlign, rowStride);
-        const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
-            &A[rowShift*ALDim],        rowStride*ALDim,
-            &BPortions[k*portionSize], height);
-    }
+    // The t'th local column of every portion is copied by the same task
+    PackFor(
+        Length_(width, 0, rowStride), height*width,
+        [&](Int t)
+        {
+            for (Int k=0; k<rowStride; ++k)
+            {
+                const Int j = Shift_(k, rowAlign, rowStride) + t*rowStride;
+                if (j < width)
+                    MemCopy(
+                        &BPortions[k*portionSize+t*height],
+                        &A[j*ALDim], height);
+            }
+        });
 }
 
 template <typename T, typename>
@@ -172,15 +241,19 @@ void RowStridedUnpack(
     T* B,         Int BLDim,
     SyncInfo<Device::CPU>)
 {
-    for (Int k=0; k<rowStride; ++k)
-    {
-        const Int rowShift = Shift_(k, rowAlign, rowStride);
-        const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
-            &APortions[k*portionSize], height,
-            &B[rowShift*BLDim],        rowStride*BLDim);
-    }
+    PackFor(
+        Length_(width, 0, rowStride), height*width,
+        [&](Int t)
+        {
+            for (Int k=0; k<rowStride; ++k)
+            {
+                const Int j = Shift_(k, rowAlign, rowStride) + t*rowStride;
+                if (j < width)
+                    MemCopy(
+                        &B[j*BLDim],
+                        &APortions[k*portionSize+t*height], height);
+            }
+        });
 }
 
 template <typename T, typename>
@@ -193,17 +266,23 @@ void PartialRowStridedPack(
     T* BPortions, Int portionSize,
     SyncInfo<Device::CPU>)
 {
-    for (Int k=0; k<rowStrideUnion; ++k)
-    {
-        const Int rowShift =
-            Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
-        const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
-        const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
-            &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
-            &BPortions[k*portionSize], height);
-    }
+    PackFor(
+        Length_(width, 0, rowStride), height*width/rowStridePart,
+        [&](Int t)
+        {
+            for (Int k=0; k<rowStrideUnion; ++k)
+            {
+                const Int rowShift =
+                    Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
+                if (rowShift+t*rowStride < width)
+                {
+                    const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
+                    MemCopy(
+                        &BPortions[k*portionSize+t*height],
+                        &A[(rowOffset+t*rowStrideUnion)*ALDim], height);
+                }
+            }
+        });
 }
 
 template <typename T, typename>
@@ -216,17 +295,23 @@ void PartialRowStridedUnpack(
     T* B, Int BLDim,
     SyncInfo<Device::CPU>)
 {
-    for (Int k=0; k<rowStrideUnion; ++k)
-    {
-        const Int rowShift =
-            Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
-        const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
-        const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
-            &APortions[k*portionSize], height,
-            &B[rowOffset*BLDim],       rowStrideUnion*BLDim);
-    }
+    PackFor(
+        Length_(width, 0, rowStride), height*width/rowStridePart,
+        [&](Int t)
+        {
+            for (Int k=0; k<rowStrideUnion; ++k)
+            {
+                const Int rowShift =
+                    Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
+                if (rowShift+t*rowStride < width)
+                {
+                    const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
+                    MemCopy(
+                        &B[(rowOffset+t*rowStrideUnion)*BLDim],
+                        &APortions[k*portionSize+t*height], height);
+                }
+            }
+        });
 }
 
 #ifdef HYDROGEN_HAVE_GPU
@@ -356,6 +441,76 @@ void PartialRowStridedUnpack(
 
 #endif // HYDROGEN_HAVE_GPU
 
+// Pack (unpack) all of the portions in a single pass over the columns of A
+// (B) rather than in one strided pass per portion, which is only done on
+// the CPU. Returns whether the (un)packing was done.
+template <typename T, Device D>
+bool FusedColStridedPack(
+    Int, Int, Int, Int, T const*, Int, T*, Int, SyncInfo<D> const&)
+{
+    return false;
+}
+
+template <typename T>
+bool FusedColStridedPack(
+    Int height, Int width,
+    Int colAlign, Int colStride,
+    T const* A, Int ALDim,
+    T* BPortions, Int portionSize,
+    SyncInfo<Device::CPU> const&)
+{
+    // A single column is better split into blocks by InterleaveMatrix
+    if (width == 1)
+        return false;
+    PackFor(
+        width, height*width,
+        [&](Int j)
+        {
+            for (Int k=0; k<colStride; ++k)
+            {
+                const Int colShift = Shift_(k, colAlign, colStride);
+                const Int localHeight = Length_(height, colShift, colStride);
+                StridedVectorCopy(
+                    &BPortions[k*portionSize+j*localHeight], 1,
+                    &A[colShift+j*ALDim], colStride, localHeight);
+            }
+        });
+    return true;
+}
+
+template <typename T, Device D>
+bool FusedColStridedUnpack(
+    Int, Int, Int, Int, T const*, Int, T*, Int, SyncInfo<D> const&)
+{
+    return false;
+}
+
+template <typename T>
+bool FusedColStridedUnpack(
+    Int height, Int width,
+    Int colAlign, Int colStride,
+    T const* APortions, Int portionSize,
+    T* B, Int BLDim,
+    SyncInfo<Device::CPU> const&)
+{
+    if (width == 1)
+        return false;
+    PackFor(
+        width, height*width,
+        [&](Int j)
+        {
+            for (Int k=0; k<colStride; ++k)
+            {
+                const Int colShift = Shift_(k, colAlign, colStride);
+                const Int localHeight = Length_(height, colShift, colStride);
+                StridedVectorCopy(
+                    &B[colShift+j*BLDim], colStride,
+                    &APortions[k*portionSize+j*localHeight], 1, localHeight);
+            }
+        });
+    return true;
+}
+
 template <typename T, Device D, typename>
 void ColStridedPack(
     Int height, Int width,
@@ -364,6 +519,10 @@ void ColStridedPack(
     T* BPortions, Int portionSize,
     SyncInfo<D> syncInfo)
 {
+    if (FusedColStridedPack(
+            height, width, colAlign, colStride,
+            A, ALDim, BPortions, portionSize, syncInfo))
+        return;
     for (Int k=0; k<colStride; ++k)
     {
         const Int colShift = Shift_(k, colAlign, colStride);
@@ -404,6 +563,10 @@ void ColStridedUnpack(
     T* B,         Int BLDim,
     SyncInfo<D> syncInfo)
 {
+    if (FusedColStridedUnpack(
+            height, width, colAlign, colStride,
+            APortions, portionSize, B, BLDim, syncInfo))
+        return;
     for (Int k=0; k<colStride; ++k)
     {
         const Int colShift = Shift_(k, colAlign, colStride);
@@ -11,17 +11,29 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseFill( Matrix<T, Device::CPU>& A, function<T(void)> func )
+// The entries are filled in column-major order (e.g., so that a sequence of
+// pseudo-random numbers is reproducible), so the loops are not parallelized.
+// Accepting an arbitrary callable allows it to be inlined.
+template<typename T,typename FuncT>
+void EntrywiseFill( Matrix<T, Device::CPU>& A, FuncT func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
     for( Int j=0; j<n; ++j )
+    {
+        T* ACol = &ABuf[j*ALDim];
         for( Int i=0; i<m; ++i )
-            A(i,j) = func();
+            ACol[i] = func();
+    }
 }
 
+template<typename T>
+void EntrywiseFill( Matrix<T, Device::CPU>& A, function<T(void)> func )
+{ EntrywiseFill<T,function<T(void)>>( A, std::move(func) ); }
+
 // FIXME: Make proper kernel
 #ifdef HYDROGEN_HAVE_GPU
 template <typename T>
@@ -34,9 +46,13 @@ void EntrywiseFill(Matrix<T,Device::GPU> &A, function<T(void)> func)
 }
 #endif // HYDROGEN_HAVE_GPU
 
+template<typename T,typename FuncT>
+void EntrywiseFill( AbstractDistMatrix<T>& A, FuncT func )
+{ EntrywiseFill( dynamic_cast<Matrix<T,Device::CPU>&>(A.Matrix()), func ); }
+
 template<typename T>
 void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func )
-{ EntrywiseFill( dynamic_cast<Matrix<T,Device::CPU>&>(A.Matrix()), func ); }
+{ EntrywiseFill<T,function<T(void)>>( A, std::move(func) ); }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
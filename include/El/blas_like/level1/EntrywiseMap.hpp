@@ -17,14 +17,14 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
+// The overloads that accept an arbitrary callable (e.g., a lambda) allow the
+// map to be inlined into, and vectorized within, the loops below; the
+// overloads that accept a std::function forward to them.
+
+template<typename T,typename FuncT>
+void EntrywiseMap(Matrix<T,Device::CPU>& A, FuncT func)
 {
     EL_DEBUG_CSE
-
-    if (A.GetDevice() != Device::CPU)
-        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
-
     const Int m = A.Height();
     const Int n = A.Width();
     T* ABuf = A.Buffer();
@@ -54,19 +54,11 @@ void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
     }
 }
 
-template<typename T>
-void EntrywiseMap(AbstractDistMatrix<T>& A, function<T(const T&)> func)
-{ EntrywiseMap(A.Matrix(), func); }
-
-template<typename S,typename T>
+template<typename S,typename T,typename FuncT>
 void EntrywiseMap
-(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, function<T(const S&)> func)
+(const Matrix<S,Device::CPU>& A, Matrix<T,Device::CPU>& B, FuncT func)
 {
     EL_DEBUG_CSE
-
-    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU))
-        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
-
     const Int m = A.Height();
     const Int n = A.Width();
     B.Resize(m, n);
@@ -85,12 +77,106 @@ void EntrywiseMap
     }
 }
 
+// C(i,j) := func(A(i,j),B(i,j)), without forming any temporaries
+template<typename R,typename S,typename T,typename FuncT>
+void EntrywiseMap
+(const Matrix<R,Device::CPU>& A,
+ const Matrix<S,Device::CPU>& B,
+       Matrix<T,Device::CPU>& C,
+ FuncT func)
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if (B.Height() != m || B.Width() != n)
+        LogicError
+        ("EntrywiseMap: A was ",m," x ",n," but B was ",
+         B.Height()," x ",B.Width());
+    C.Resize(m, n);
+    const R* ABuf = A.LockedBuffer();
+    const S* BBuf = B.LockedBuffer();
+    T* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int CLDim = C.LDim();
+    EL_PARALLEL_FOR
+    for(Int j=0; j<n; ++j)
+    {
+        EL_SIMD
+        for(Int i=0; i<m; ++i)
+        {
+            CBuf[i+j*CLDim] = func(ABuf[i+j*ALDim], BBuf[i+j*BLDim]);
+        }
+    }
+}
+
+template<typename T,typename FuncT>
+void EntrywiseMap(AbstractMatrix<T>& A, FuncT func)
+{
+    EL_DEBUG_CSE
+
+    if (A.GetDevice() != Device::CPU)
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+
+    EntrywiseMap(static_cast<Matrix<T,Device::CPU>&>(A), func);
+}
+
+template<typename T,typename FuncT>
+void EntrywiseMap(AbstractDistMatrix<T>& A, FuncT func)
+{ EntrywiseMap(A.Matrix(), func); }
+
+template<typename S,typename T,typename FuncT>
+void EntrywiseMap
+(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, FuncT func)
+{
+    EL_DEBUG_CSE
+
+    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU))
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+
+    EntrywiseMap
+    (static_cast<const Matrix<S,Device::CPU>&>(A),
+     static_cast<Matrix<T,Device::CPU>&>(B), func);
+}
+
+template<typename R,typename S,typename T,typename FuncT>
+void EntrywiseMap
+(const AbstractMatrix<R>& A,
+ const AbstractMatrix<S>& B,
+       AbstractMatrix<T>& C,
+ FuncT func)
+{
+    EL_DEBUG_CSE
+
+    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU) ||
+        (C.GetDevice() != Device::CPU))
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+
+    EntrywiseMap
+    (static_cast<const Matrix<R,Device::CPU>&>(A),
+     static_cast<const Matrix<S,Device::CPU>&>(B),
+     static_cast<Matrix<T,Device::CPU>&>(C), func);
+}
+
+template<typename T>
+void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
+{ EntrywiseMap<T,function<T(const T&)>>(A, std::move(func)); }
+
+template<typename T>
+void EntrywiseMap(AbstractDistMatrix<T>& A, function<T(const T&)> func)
+{ EntrywiseMap<T,function<T(const T&)>>(A, std::move(func)); }
+
+template<typename S,typename T>
+void EntrywiseMap
+(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, function<T(const S&)> func)
+{ EntrywiseMap<S,T,function<T(const S&)>>(A, B, std::move(func)); }
+
 template <Dist U, Dist V, DistWrap W, Device D, typename S, typename T,
-          typename=EnableIf<IsDeviceValidType<S,D>>>
+          typename FuncT, typename=EnableIf<IsDeviceValidType<S,D>>>
 void EntrywiseMap_payload(
     AbstractDistMatrix<S> const& A,
     AbstractDistMatrix<T>& B,
-    function<T(const S&)> func)
+    FuncT func)
 {
     DistMatrix<S,U,V,W,D> AProx(B.Grid());
     AProx.AlignWith(B.DistData());
@@ -99,21 +185,23 @@ void EntrywiseMap_payload(
 }
 
 template <Dist U, Dist V, DistWrap W, Device D, typename S, typename T,
-          typename=DisableIf<IsDeviceValidType<S,D>>, typename=void>
+          typename FuncT, typename=DisableIf<IsDeviceValidType<S,D>>,
+          typename=void>
 void EntrywiseMap_payload(
     AbstractDistMatrix<S> const&,
     AbstractDistMatrix<T>&,
-    function<T(const S&)>)
+    FuncT)
 {
     LogicError("EntrywiseMap: Bad device/type combination.");
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename FuncT>
 void EntrywiseMap
 (const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B,
-        function<T(const S&)> func)
+        FuncT func)
 {
+    EL_DEBUG_CSE
     if (A.DistData().colDist == B.DistData().colDist &&
         A.DistData().rowDist == B.DistData().rowDist &&
         A.Wrap() == B.Wrap())
@@ -136,6 +224,81 @@ void EntrywiseMap
     }
 }
 
+template<typename S,typename T>
+void EntrywiseMap
+(const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+        function<T(const S&)> func)
+{
+    EL_DEBUG_CSE
+    EntrywiseMap<S,T,function<T(const S&)>>(A, B, std::move(func));
+}
+
+template <Dist U, Dist V, DistWrap W, Device D, typename S,
+          typename=EnableIf<IsDeviceValidType<S,D>>>
+void EntrywiseMapRedistribute_payload(
+    AbstractDistMatrix<S> const& B,
+    AbstractDistMatrix<S> const& A,
+    std::unique_ptr<AbstractDistMatrix<S>>& BLikeA)
+{
+    BLikeA.reset(new DistMatrix<S,U,V,W,D>(A.Grid()));
+    BLikeA->AlignWith(A.DistData());
+    Copy(B, *BLikeA);
+}
+
+template <Dist U, Dist V, DistWrap W, Device D, typename S,
+          typename=DisableIf<IsDeviceValidType<S,D>>, typename=void>
+void EntrywiseMapRedistribute_payload(
+    AbstractDistMatrix<S> const&,
+    AbstractDistMatrix<S> const&,
+    std::unique_ptr<AbstractDistMatrix<S>>&)
+{
+    LogicError("EntrywiseMap: Bad device/type combination.");
+}
+
+// C(i,j) := func(A(i,j),B(i,j)), where C takes on the distribution of A and B
+// is only redistributed if it is not already distributed like A
+template<typename R,typename S,typename T,typename FuncT>
+void EntrywiseMap
+(const AbstractDistMatrix<R>& A,
+ const AbstractDistMatrix<S>& B,
+       AbstractDistMatrix<T>& C,
+ FuncT func)
+{
+    EL_DEBUG_CSE
+    AssertSameGrids(A.Grid(), B.Grid(), C.Grid());
+    if (A.GetLocalDevice() != Device::CPU ||
+        B.GetLocalDevice() != Device::CPU ||
+        C.GetLocalDevice() != Device::CPU)
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+    if (A.DistData().colDist != C.DistData().colDist ||
+        A.DistData().rowDist != C.DistData().rowDist ||
+        A.Wrap() != C.Wrap())
+        LogicError("EntrywiseMap: A and C must have the same distribution");
+    C.AlignWith(A.DistData());
+    C.Resize(A.Height(), A.Width());
+
+    if (B.DistData() == A.DistData())
+    {
+        EntrywiseMap(A.LockedMatrix(), B.LockedMatrix(), C.Matrix(), func);
+    }
+    else
+    {
+        std::unique_ptr<AbstractDistMatrix<S>> BLikeA;
+        #define GUARD(CDIST,RDIST,WRAP,DEVICE) \
+          A.DistData().colDist == CDIST && A.DistData().rowDist == RDIST && \
+              A.Wrap() == WRAP && DEVICE == Device::CPU
+        #define PAYLOAD(CDIST,RDIST,WRAP,DEVICE) \
+            EntrywiseMapRedistribute_payload<CDIST,RDIST,WRAP,DEVICE>\
+            (B,A,BLikeA);
+        #include <El/macros/DeviceGuardAndPayload.h>
+        #undef GUARD
+        #undef PAYLOAD
+        EntrywiseMap
+        (A.LockedMatrix(), BLikeA->LockedMatrix(), C.Matrix(), func);
+    }
+}
+
 #if defined HYDROGEN_HAVE_GPU
 // This section only valid when device-compiling.
 #if defined __CUDACC__ || defined __HIPCC__
@@ -11,8 +11,11 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+// The overloads that accept an arbitrary callable allow it to be inlined
+// into the loops below; the std::function overloads forward to them.
+
+template<typename T,typename FuncT>
+void IndexDependentFill( Matrix<T>& A, FuncT func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -45,9 +48,8 @@ void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
 
 }
 
-template<typename T>
-void IndexDependentFill
-( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+template<typename T,typename FuncT>
+void IndexDependentFill( AbstractDistMatrix<T>& A, FuncT func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -59,11 +61,11 @@ void IndexDependentFill
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = A.GlobalCol(0);
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
             const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
             ALocBuf[iLoc] = func(i,j);
         }
     }
@@ -72,18 +74,28 @@ void IndexDependentFill
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
+            T* ALocCol = &ALocBuf[jLoc*ALocLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
                 const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j);
+                ALocCol[iLoc] = func(i,j);
             }
         }
     }
 
 }
 
+template<typename T>
+void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, std::move(func) ); }
+
+template<typename T>
+void IndexDependentFill
+( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, std::move(func) ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
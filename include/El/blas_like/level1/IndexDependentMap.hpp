@@ -11,8 +11,11 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+// The overloads that accept an arbitrary callable allow the map to be inlined
+// into the loops below; the std::function overloads forward to them.
+
+template<typename T,typename FuncT>
+void IndexDependentMap( Matrix<T>& A, FuncT func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -45,8 +48,8 @@ void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
 
 }
 
-template<typename T>
-void IndexDependentMap( AbstractMatrix<T>& A, function<T(Int,Int,const T&)> func )
+template<typename T,typename FuncT>
+void IndexDependentMap( AbstractMatrix<T>& A, FuncT func )
 {
     switch(A.GetDevice()) {
     case Device::CPU:
@@ -63,9 +66,8 @@ void IndexDependentMap( AbstractMatrix<T>& A, function<T(Int,Int,const T&)> func
     }
 }
 
-template<typename T>
-void IndexDependentMap
-( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+template<typename T,typename FuncT>
+void IndexDependentMap( AbstractDistMatrix<T>& A, FuncT func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -77,11 +79,11 @@ void IndexDependentMap
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = A.GlobalCol(0);
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
             const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
             ALocBuf[iLoc] = func(i,j,ALocBuf[iLoc]);
         }
     }
@@ -90,21 +92,21 @@ void IndexDependentMap
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
+            T* ALocCol = &ALocBuf[jLoc*ALocLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
                 const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j,ALocBuf[iLoc+jLoc*ALocLDim]);
+                ALocCol[iLoc] = func(i,j,ALocCol[iLoc]);
             }
         }
     }
 
 }
 
-template<typename S,typename T>
-void IndexDependentMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+template<typename S,typename T,typename FuncT>
+void IndexDependentMap( const Matrix<S>& A, Matrix<T>& B, FuncT func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -140,11 +142,11 @@ void IndexDependentMap
 
 }
 
-template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,typename FuncT>
 void IndexDependentMap
 ( const DistMatrix<S,U,V,wrap>& A,
         DistMatrix<T,U,V,wrap>& B,
-  function<T(Int,Int,const S&)> func )
+  FuncT func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -160,11 +162,11 @@ void IndexDependentMap
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = A.GlobalCol(0);
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
             const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
             BLocBuf[iLoc] = func(i,j,ALocBuf[iLoc]);
         }
     }
@@ -173,18 +175,52 @@ void IndexDependentMap
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
+            const S* ALocCol = &ALocBuf[jLoc*ALocLDim];
+            T* BLocCol = &BLocBuf[jLoc*BLocLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
                 const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                BLocBuf[iLoc+jLoc*BLocLDim] = func(i,j,ALocBuf[iLoc+jLoc*ALocLDim]);
+                BLocCol[iLoc] = func(i,j,ALocCol[iLoc]);
             }
         }
     }
 
 }
 
+template<typename T>
+void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, std::move(func) ); }
+
+template<typename T>
+void IndexDependentMap
+( AbstractMatrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, std::move(func) ); }
+
+template<typename T>
+void IndexDependentMap
+( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, std::move(func) ); }
+
+template<typename S,typename T>
+void IndexDependentMap
+( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+{
+    IndexDependentMap<S,T,function<T(Int,Int,const S&)>>
+    ( A, B, std::move(func) );
+}
+
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+void IndexDependentMap
+( const DistMatrix<S,U,V,wrap>& A,
+        DistMatrix<T,U,V,wrap>& B,
+  function<T(Int,Int,const S&)> func )
+{
+    IndexDependentMap<S,T,U,V,wrap,function<T(Int,Int,const S&)>>
+    ( A, B, std::move(func) );
+}
+
 template<typename S,typename T,Dist U,Dist V>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
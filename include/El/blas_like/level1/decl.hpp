@@ -620,6 +620,45 @@ void StridedUnpack(
 namespace El
 {
 
+// A plan for repeatedly forming B := A between two element-wise
+// distributions with the same shapes and alignments, e.g., within the loop
+// of a blocked algorithm.
+//
+// The plan is keyed on the distribution data (including the alignments and
+// the grid) of A and B and on the shape of A. The local entries of A sent
+// to, and the local entries of B received from, each process are listed
+// once, together with the buffers for the exchange, so that each
+// application performs no allocation and at most one all-to-all exchange
+// over the VC communicator. Each entry is read from a single copy of A,
+// preferring the local one.
+template<typename T>
+class RedistPlan
+{
+public:
+    RedistPlan( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B );
+
+    // Whether the plan applies to B := A
+    bool Matches
+    ( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B ) const;
+
+    void Apply( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+private:
+    DistData ADist_, BDist_;
+    Int height_, width_;
+
+    // The local coordinates of the entries of A sent to (and of B received
+    // from) each other process, ordered by the VC rank of that process
+    vector<Int> sendRows_, sendCols_, recvRows_, recvCols_;
+    vector<int> sendCounts_, sendOffs_, recvCounts_, recvOffs_;
+    // The local coordinates of the entries of A copied into B without
+    // communication
+    vector<Int> copyARows_, copyACols_, copyBRows_, copyBCols_;
+    // Whether any process exchanges entries with another
+    bool exchange_=false;
+    vector<T> sendBuf_, recvBuf_;
+};
+
 // DiagonalScale
 // =============
 #ifdef HYDROGEN_HAVE_GPU
@@ -745,6 +784,11 @@ void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func );
 template<typename T>
 void EntrywiseFill( Matrix<T,Device::GPU>& A, function<T(void)> func );
 #endif // HYDROGEN_HAVE_GPU
+// Versions that inline an arbitrary callable
+template<typename T,typename FuncT>
+void EntrywiseFill( Matrix<T>& A, FuncT func );
+template<typename T,typename FuncT>
+void EntrywiseFill( AbstractDistMatrix<T>& A, FuncT func );
 
 // EntrywiseMap
 // ============
@@ -761,6 +805,36 @@ void EntrywiseMap
 ( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B,
   function<T(const S&)> func );
 
+// Versions that inline an arbitrary callable
+template<typename T,typename FuncT>
+void EntrywiseMap( Matrix<T>& A, FuncT func );
+template<typename T,typename FuncT>
+void EntrywiseMap( AbstractMatrix<T>& A, FuncT func );
+template<typename T,typename FuncT>
+void EntrywiseMap( AbstractDistMatrix<T>& A, FuncT func );
+
+template<typename S,typename T,typename FuncT>
+void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, FuncT func );
+template<typename S,typename T,typename FuncT>
+void EntrywiseMap( const AbstractMatrix<S>& A, AbstractMatrix<T>& B, FuncT func );
+template<typename S,typename T,typename FuncT>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B, FuncT func );
+
+// C(i,j) := func(A(i,j),B(i,j)), fusing what would otherwise be several
+// entrywise passes into one
+template<typename R,typename S,typename T,typename FuncT>
+void EntrywiseMap
+( const Matrix<R>& A, const Matrix<S>& B, Matrix<T>& C, FuncT func );
+template<typename R,typename S,typename T,typename FuncT>
+void EntrywiseMap
+( const AbstractMatrix<R>& A, const AbstractMatrix<S>& B,
+        AbstractMatrix<T>& C, FuncT func );
+template<typename R,typename S,typename T,typename FuncT>
+void EntrywiseMap
+( const AbstractDistMatrix<R>& A, const AbstractDistMatrix<S>& B,
+        AbstractDistMatrix<T>& C, FuncT func );
+
 // Fill
 // ====
 template<typename T>
@@ -949,6 +1023,11 @@ void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func );
 template<typename T>
 void IndexDependentFill
 ( AbstractDistMatrix<T>& A, function<T(Int,Int)> func );
+// Versions that inline an arbitrary callable
+template<typename T,typename FuncT>
+void IndexDependentFill( Matrix<T>& A, FuncT func );
+template<typename T,typename FuncT>
+void IndexDependentFill( AbstractDistMatrix<T>& A, FuncT func );
 
 // IndexDependentMap
 // =================
@@ -979,6 +1058,21 @@ void IndexDependentMap
         DistMatrix<T,U,V,BLOCK>& B,
         function<T(Int,Int,const S&)> func );
 
+// Versions that inline an arbitrary callable
+template<typename T,typename FuncT>
+void IndexDependentMap( Matrix<T>& A, FuncT func );
+template<typename T,typename FuncT>
+void IndexDependentMap( AbstractMatrix<T>& A, FuncT func );
+template<typename T,typename FuncT>
+void IndexDependentMap( AbstractDistMatrix<T>& A, FuncT func );
+template<typename S,typename T,typename FuncT>
+void IndexDependentMap( const Matrix<S>& A, Matrix<T>& B, FuncT func );
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,typename FuncT>
+void IndexDependentMap
+( const DistMatrix<S,U,V,wrap>& A,
+        DistMatrix<T,U,V,wrap>& B,
+        FuncT func );
+
 // Kronecker product
 // =================
 template<typename T>
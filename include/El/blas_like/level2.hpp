@@ -86,6 +86,59 @@ void LocalGemv
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& x,
   T beta,        AbstractDistMatrix<T>& y );
 
+// A plan for repeatedly forming Y := alpha op(A) X + beta Y with the same A
+// and with X and Y of fixed shapes and alignments, e.g., within the inner
+// loop of a Krylov solver. X and Y may hold several vectors as columns.
+//
+// The routing of the entries of X to the processes that own the matching
+// columns (rows) of A, and of the partial products back to the owners of Y,
+// is computed once, together with the buffers for both exchanges, so that
+// each application performs no allocation and exactly two all-to-all
+// exchanges over the VC communicator.
+//
+// A is referenced rather than copied: its entries may change between
+// applications, but its shape and distribution may not.
+template<typename T>
+class GemvPlan
+{
+public:
+    GemvPlan
+    ( Orientation orientation,
+      const DistMatrix<T>& A,
+      const DistMatrix<T,VC,STAR>& X,
+      const DistMatrix<T,VC,STAR>& Y );
+
+    void Apply
+    ( T alpha, const DistMatrix<T,VC,STAR>& X,
+      T beta,        DistMatrix<T,VC,STAR>& Y );
+
+private:
+    // The local rows of an exchange, ordered by the VC rank of the process
+    // that they are sent to (or received from)
+    struct Exchange
+    {
+        vector<Int> sendRows, recvRows;
+        vector<int> sendCounts, sendOffs, recvCounts, recvOffs;
+    };
+
+    void CheckConformal
+    ( const DistMatrix<T,VC,STAR>& X,
+      const DistMatrix<T,VC,STAR>& Y ) const;
+
+    Orientation orientation_;
+    const DistMatrix<T>* A_;
+    Int AHeight_, AWidth_;
+    int AColAlign_, ARowAlign_;
+    Int XHeight_, YHeight_, width_;
+    int XAlign_, YAlign_;
+
+    Exchange XExchange_, ZExchange_;
+    // The local rows of X for the local columns (rows) of A and the local
+    // partial products
+    Matrix<T> XLocal_, ZLocal_;
+    vector<T> sendBuf_, recvBuf_;
+};
+
 // Ger
 // ===
 template<typename T>
@@ -29,11 +29,68 @@ enum GemmAlgorithm {
   GEMM_SUMMA_C_MS,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_3D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// Machine parameters of the alpha-beta-gamma cost model that GEMM_DEFAULT
+// consults to choose between the distributed Gemm algorithms
+struct GemmCostModel
+{
+    // Seconds per message (alpha)
+    double latency=1.e-6;
+    // Seconds per byte communicated (beta)
+    double inverseBandwidth=1.e-9;
+    // Seconds per local flop (gamma)
+    double flopTime=1.e-10;
+};
+
+// Measure the machine parameters for the given grid and device and cache them
+// on the grid. The measurement is collective over grid.ViewingComm() and only
+// happens if nothing is cached yet. Since the first GEMM_DEFAULT product on a
+// grid calls this implicitly, either call it explicitly on every process after
+// creating the grid or make sure that every process viewing the grid takes
+// part in that first product.
+const GemmCostModel&
+CalibrateGemmCostModel( const Grid& grid, Device D=Device::CPU );
+// Override the cached machine parameters (e.g., with known values). This must
+// be done consistently on every process viewing the grid, or the processes
+// without a cached model would enter the collective measurement alone.
+void SetGemmCostModel
+( const Grid& grid, const GemmCostModel& model, Device D=Device::CPU );
+// Drop the machine parameters cached on the grid
+void ClearGemmCostModels( const Grid& grid );
+
+// Whether the CPU SUMMA algorithms prefetch the next panel with nonblocking
+// collectives while the current panel is multiplied (default: false)
+void SetGemmPipelining( bool pipeline );
+bool GemmPipelining();
+
+// The number of layers that GEMM_3D replicates the process grid over; it must
+// divide the grid size. A value of zero (the default) selects the largest
+// divisor c of the grid size with c^3 <= p, and GEMM_DEFAULT only considers
+// GEMM_3D when more than one layer has been explicitly requested, since each
+// layer holds a copy of a slab of A and B and a full copy of C.
+void SetGemm3DReplication( int numLayers );
+int Gemm3DReplication();
+
+// Estimated runtime (in seconds) of a distributed Gemm algorithm for the
+// shapes, distributions, and grid of the given operands
+template<typename T>
+double GemmCost
+( GemmAlgorithm alg, Orientation orientA, Orientation orientB,
+  const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  const AbstractDistMatrix<T>& C, const GemmCostModel& model );
+
+// The (non-multistream) algorithm that GEMM_DEFAULT selects
+template<typename T>
+GemmAlgorithm DefaultGemmAlgorithm
+( Orientation orientA, Orientation orientB,
+  const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  const AbstractDistMatrix<T>& C );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -89,6 +146,29 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// GemmBatched
+// ===========
+// C[l] := alpha op(A[l]) op(B[l]) + beta C[l] for every l, where the products
+// may differ in size. The products are distributed over the OpenMP threads,
+// and those with tiny dimensions bypass BLAS in favor of a direct loop.
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C );
+
+// The same products for a batch of equally-sized matrices that are stored
+// with fixed strides between consecutive members of a single buffer, as in
+// the GPU routine of the same name
+template<typename T>
+void GemmStridedBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim, Int AStride,
+           const T* B, Int BLDim, Int BStride,
+  T beta,        T* C, Int CLDim, Int CStride,
+  Int batchCount );
+
 // Hemm
 // ====
 template<typename T>
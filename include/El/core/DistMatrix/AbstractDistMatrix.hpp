@@ -33,6 +33,12 @@ public:
     virtual El::DistData DistData() const noexcept = 0;
 };// class BaseDistMatrix
 
+// The maximum number of queued remote updates (or pulls) that each process
+// exchanges per round of ProcessQueues (or ProcessPullQueue), which bounds
+// the memory used by their communication buffers
+Int QueueRoundSize();
+void SetQueueRoundSize(Int roundSize);
+
 template<typename Ring>
 class AbstractDistMatrix : public BaseDistMatrix
 {
@@ -10,8 +10,14 @@
 #ifndef EL_GRID_HPP
 #define EL_GRID_HPP
 
+#include <map>
+#include <memory>
+#include <typeindex>
+
 namespace El {
 
+struct GemmCostModel;
+
 class Grid
 {
 public:
@@ -93,6 +99,16 @@ public:
     int BlacsMCMRContext() const;
 #endif
 
+    // Replication of this grid over 'depth' layers (for 2.5D algorithms):
+    // layer l consists of the owning ranks [l*Size()/depth,(l+1)*Size()/depth)
+    // arranged as a default-height grid, and the depth communicator connects
+    // the processes with the same rank in each layer. The layers are built on
+    // first use (collectively over the owning communicator) and cached for
+    // the lifetime of this grid; 'depth' must divide Size().
+    const Grid& LayerGrid( int depth, int layer ) const;
+    int Layer( int depth ) const EL_NO_RELEASE_EXCEPT;
+    mpi::Comm const& DepthComm( int depth ) const;
+
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
 
     // To be used internally by Elemental
@@ -103,6 +119,23 @@ public:
     static const Grid& Default() EL_NO_RELEASE_EXCEPT;
     static const Grid& Trivial() EL_NO_RELEASE_EXCEPT;
 
+    // The machine parameters of the Gemm cost model for this grid and the
+    // given device (null until measured or set; see CalibrateGemmCostModel)
+    std::shared_ptr<const GemmCostModel>&
+    CachedGemmCostModel( Device D ) const;
+
+    // The most recent RedistPlan<T> of copy::GeneralPurpose on this grid,
+    // keyed by typeid(T) (null until the first such redistribution)
+    std::shared_ptr<void>& CachedRedistPlan( std::type_index type ) const;
+
+    // The counter-based random streams keyed on this grid (see NewPhiloxKey):
+    // the InitializeRandom epoch in which they were keyed and their number
+    struct PhiloxStreams
+    {
+        Int epoch=-1, count=0;
+    };
+    PhiloxStreams& CachedPhiloxStreams() const;
+
 private:
     bool haveViewers_;
     int height_, size_, gcd_;
@@ -136,6 +169,15 @@ private:
     int blacsMCMRContext_;
 #endif
 
+    struct Layers;
+    mutable std::map<int,std::unique_ptr<Layers>> layers_;
+    const Layers& GetLayers( int depth ) const;
+
+    mutable std::map<Device,std::shared_ptr<const GemmCostModel>>
+      gemmCostModels_;
+    mutable std::map<std::type_index,std::shared_ptr<void>> redistPlans_;
+    mutable PhiloxStreams philoxStreams_;
+
     void SetUpGrid();
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
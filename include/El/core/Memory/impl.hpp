@@ -130,7 +130,7 @@ G* New( size_t size, unsigned int mode, SyncInfo<Device::GPU> const& syncInfo_ )
 #endif
 #ifdef HYDROGEN_HAVE_CUB
     case 1:
-        status = hydrogen::cub::MemoryPool().DeviceAllocate(
+        status = hydrogen::cub::Allocate(
             reinterpret_cast<void**>(&ptr),
             size * sizeof(G),
             syncInfo_.Stream());
@@ -174,10 +174,10 @@ void Delete( G*& ptr, unsigned int mode, SyncInfo<Device::GPU> const& )
     case 1:
 #if defined HYDROGEN_HAVE_CUDA
         H_CHECK_CUDA(
-            hydrogen::cub::MemoryPool().DeviceFree(ptr));
+            hydrogen::cub::Free(ptr));
 #elif defined HYDROGEN_HAVE_ROCM
         H_CHECK_HIP(
-            hydrogen::cub::MemoryPool().DeviceFree(ptr));
+            hydrogen::cub::Free(ptr));
 #endif
         break;
 #endif // HYDROGEN_HAVE_CUB
@@ -8,12 +8,20 @@
 #include <hip/hip_runtime.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <deque>
+#include <limits>
+#include <memory>
 #include <mutex>
+#include <ostream>
 #include <set>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -29,13 +37,96 @@ void ThrowRuntimeError(Args&&... args)
     (void) dummy;
     throw std::runtime_error(oss.str());
 }
+
+/** Index of the calling thread, assigned on first use. */
+inline size_t ThisThreadIndex() noexcept
+{
+    static std::atomic<size_t> next_index(0);
+    thread_local size_t const index = next_index++;
+    return index;
+}
+
 } // namespace details
 
+/** Usage statistics of a memory pool. */
+struct MemoryPoolStatistics
+{
+    /** Counters for a single bin. */
+    struct Bin
+    {
+        /** Size in bytes of the allocations in this bin. */
+        size_t size;
+        /** Allocations served from cached memory. */
+        size_t hits;
+        /** Allocations that required new memory. */
+        size_t misses;
+        /** Allocations currently cached for reuse. */
+        size_t cached;
+    };
+
+    /** Bytes handed out and not yet freed. */
+    size_t bytes_live = 0;
+    /** Bytes held for reuse. */
+    size_t bytes_cached = 0;
+    /** High-water mark of bytes_live. */
+    size_t peak_bytes_live = 0;
+    /** High-water mark of bytes_live + bytes_cached. */
+    size_t peak_bytes_total = 0;
+    /** Allocations too large for any bin, allocated and freed directly. */
+    size_t oversize_allocations = 0;
+    /** Cached bytes released to respect the cache limit. */
+    size_t bytes_trimmed = 0;
+    /** Limit on bytes_cached. */
+    size_t max_bytes_cached = 0;
+    /** Counters for every bin. */
+    std::vector<Bin> bins;
+};
+
+/** Print the nonzero statistics of a memory pool. */
+inline void PrintMemoryPoolStatistics(
+    std::ostream& os, MemoryPoolStatistics const& stats)
+{
+    os << "  live bytes:           " << stats.bytes_live
+       << " (peak " << stats.peak_bytes_live << ")\n"
+       << "  cached bytes:         " << stats.bytes_cached << " (limit ";
+    if (stats.max_bytes_cached == std::numeric_limits<size_t>::max())
+        os << "none";
+    else
+        os << stats.max_bytes_cached;
+    os << ")\n"
+       << "  peak total bytes:     " << stats.peak_bytes_total << "\n"
+       << "  oversize allocations: " << stats.oversize_allocations << "\n"
+       << "  trimmed bytes:        " << stats.bytes_trimmed << "\n"
+       << "  bin size, hits, misses, cached:\n";
+    for (auto const& bin : stats.bins)
+    {
+        if (bin.hits == 0 && bin.misses == 0 && bin.cached == 0)
+            continue;
+        os << "    " << bin.size << ", " << bin.hits << ", "
+           << bin.misses << ", " << bin.cached << "\n";
+    }
+}
+
 /** Simple caching memory pool.
  *  This maintains a set of bins that contain allocations of a fixed size.
  *  Each allocation will use the smallest size greater than or equal to the
  *  requested size. If an allocation is larger than any bin, it is allocated
  *  and freed directly.
+ *
+ *  Cached allocations are kept in per-thread shards ("magazines") in front
+ *  of a shared depot. A thread only locks its own shard in the common case
+ *  and touches the depot when its magazine for a bin runs empty or
+ *  overflows. Each binned allocation is preceded by a header holding its
+ *  bin, so neither allocating nor freeing it consults a shared table, and
+ *  is aligned to BLOCK_ALIGNMENT bytes. Allocations too large for any bin
+ *  are instead offset by half of that alignment and recorded in a table,
+ *  so that the two kinds are told apart from the address alone. Freeing an
+ *  unknown pointer, or one that is already freed (while it is cached), is
+ *  detected.
+ *
+ *  The amount of cached memory may be capped; once the cap is exceeded,
+ *  the least recently cached allocations are released first.
+ *
  *  This memory pool is thread-safe.
  *  @tparam Pinned Whether this pool allocates CUDA pinned memory.
  */
@@ -50,10 +141,14 @@ public:
      *  @param bin_growth Controls how fast bins grow.
      *  @param min_bin_size Smallest bin size (in bytes).
      *  @param max_bin_size Largest bin size (in bytes).
+     *  @param magazine_size Number of allocations per bin a thread caches
+     *         before returning them to the shared depot.
      */
     MemoryPool(float bin_growth = 1.6,
                size_t min_bin_size = 1,
-               size_t max_bin_size = 1<<26)
+               size_t max_bin_size = 1<<26,
+               size_t magazine_size = 32)
+        : magazine_size_(magazine_size > 1 ? magazine_size : 2)
     {
         std::set<size_t> bin_sizes;
         for (float bin_size = min_bin_size;
@@ -71,9 +166,20 @@ public:
         // Copy into bin_sizes_.
         for (const auto& size : bin_sizes)
             bin_sizes_.push_back(size);
-        // Set up bins.
-        for (size_t i = 0; i < bin_sizes_.size(); ++i)
-            free_data_.emplace_back();
+        // Set up the depot and one shard per hardware thread, rounded up to
+        // a power of 2 so the shard of a thread is a simple mask.
+        depot_.resize(bin_sizes_.size());
+        size_t const num_threads = std::thread::hardware_concurrency();
+        num_shards_ = 1;
+        while (num_shards_ < num_threads && num_shards_ < MAX_SHARDS)
+            num_shards_ *= 2;
+        shards_.reset(new Shard[num_shards_]);
+        for (size_t i = 0; i < num_shards_; ++i)
+        {
+            shards_[i].free_data.resize(bin_sizes_.size());
+            shards_[i].hits.assign(bin_sizes_.size(), 0);
+            shards_[i].misses.assign(bin_sizes_.size(), 0);
+        }
     }
     ~MemoryPool()
     {
@@ -83,80 +189,305 @@ public:
     /** Return memory of size bytes. */
     void* Allocate(size_t size)
     {
-        size_t bin = get_bin(size);
+        size_t const bin = get_bin(size);
         void* mem = nullptr;
-        std::lock_guard<std::mutex> lock(mutex_);
         // size is too large, this will not be cached.
         if (bin == INVALID_BIN)
         {
-            mem = do_allocation(size);
+            void* const base = do_allocation(size + 2*BLOCK_ALIGNMENT);
+            mem = static_cast<char*>(align_up(base)) + BLOCK_ALIGNMENT/2;
+            {
+                std::lock_guard<std::mutex> lock(oversize_mutex_);
+                oversize_blocks_[mem] = {base, size};
+            }
+            ++oversize_allocations_;
+            add_live(size);
+            return mem;
         }
-        else
+
+        // Check if there is available memory in our bin.
+        Shard& shard = local_shard();
         {
-            // Check if there is available memory in our bin.
-            if (free_data_[bin].size() > 0)
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto& magazine = shard.free_data[bin];
+            if (magazine.empty())
+                refill_magazine(bin, magazine);
+            if (!magazine.empty())
             {
-                mem = free_data_[bin].back();
-                free_data_[bin].pop_back();
+                mem = magazine.back();
+                magazine.pop_back();
+                bytes_cached_ -= bin_sizes_[bin];
+                ++shard.hits[bin];
             }
             else
             {
-                mem = do_allocation(bin_sizes_[bin]);
+                ++shard.misses[bin];
             }
         }
-        alloc_to_bin_[mem] = bin;
+        if (mem == nullptr)
+        {
+            void* const base = do_allocation(
+                bin_sizes_[bin] + sizeof(BlockHeader) + BLOCK_ALIGNMENT);
+            mem = align_up(static_cast<char*>(base) + sizeof(BlockHeader));
+            header(mem) = {base, bin, FREE_TAG};
+        }
+        header(mem).tag = LIVE_TAG;
+        add_live(bin_sizes_[bin]);
         return mem;
     }
     /** Release previously allocated memory. */
     void Free(void* ptr)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto iter = alloc_to_bin_.find(ptr);
-        if (iter == alloc_to_bin_.end())
+        auto const offset =
+            reinterpret_cast<std::uintptr_t>(ptr) % BLOCK_ALIGNMENT;
+        if (offset == BLOCK_ALIGNMENT/2)
         {
+            free_oversize(ptr);
+            return;
+        }
+        if (ptr == nullptr || offset != 0 || header(ptr).tag != LIVE_TAG)
             details::ThrowRuntimeError("Tried to free unknown ptr");
+        header(ptr).tag = FREE_TAG;
+        size_t const bin = header(ptr).bin;
+        size_t const size = bin_sizes_[bin];
+        bytes_live_ -= size;
+
+        // Cache the pointer for reuse.
+        size_t cached = 0;
+        {
+            Shard& shard = local_shard();
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            cached = (bytes_cached_ += size);
+            auto& magazine = shard.free_data[bin];
+            magazine.push_back(ptr);
+            if (magazine.size() > magazine_size_)
+                flush_magazine(bin, magazine);
+        }
+        update_peak(peak_bytes_total_, cached + bytes_live_.load());
+        if (cached > max_bytes_cached_.load())
+            Trim(max_bytes_cached_.load());
+    }
+    /** Release all unused memory. */
+    void FreeAllUnused()
+    {
+        for (size_t i = 0; i < num_shards_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+            {
+                auto& magazine = shards_[i].free_data[bin];
+                for (auto&& ptr : magazine)
+                    free_block(ptr);
+                bytes_cached_ -= magazine.size()*bin_sizes_[bin];
+                magazine.clear();
+            }
         }
-        else
+        std::lock_guard<std::mutex> lock(depot_mutex_);
+        for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
         {
-            size_t bin = iter->second;
-            alloc_to_bin_.erase(iter);
-            if (bin == INVALID_BIN)
+            for (auto&& block : depot_[bin])
+                free_block(block.ptr);
+            bytes_cached_ -= depot_[bin].size()*bin_sizes_[bin];
+            depot_[bin].clear();
+        }
+    }
+    /** Release cached memory, least recently cached first, until at most
+     *  max_bytes bytes remain cached.
+     */
+    void Trim(size_t max_bytes)
+    {
+        {
+            std::lock_guard<std::mutex> lock(depot_mutex_);
+            while (bytes_cached_.load() > max_bytes)
             {
-                do_free(ptr);
+                // Find the bin holding the oldest cached allocation.
+                size_t oldest_bin = INVALID_BIN;
+                for (size_t bin = 0; bin < depot_.size(); ++bin)
+                {
+                    if (!depot_[bin].empty()
+                        && (oldest_bin == INVALID_BIN
+                            || depot_[bin].front().tick
+                            < depot_[oldest_bin].front().tick))
+                        oldest_bin = bin;
+                }
+                if (oldest_bin == INVALID_BIN)
+                    break;
+                free_block(depot_[oldest_bin].front().ptr);
+                depot_[oldest_bin].pop_front();
+                release_cached(bin_sizes_[oldest_bin]);
             }
-            else
+        }
+        // The depot is exhausted; fall back to the per-thread magazines,
+        // whose entries were all cached more recently.
+        for (size_t i = 0; i < num_shards_; ++i)
+        {
+            if (bytes_cached_.load() <= max_bytes)
+                return;
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
             {
-                // Cache the pointer for reuse.
-                free_data_[bin].push_back(ptr);
+                size_t const cached = bytes_cached_.load();
+                if (cached <= max_bytes)
+                    break;
+                // Release the oldest entries of the magazine at once.
+                auto& magazine = shards_[i].free_data[bin];
+                size_t const excess =
+                    (cached - max_bytes + bin_sizes_[bin] - 1)
+                    / bin_sizes_[bin];
+                size_t const count = std::min(magazine.size(), excess);
+                for (size_t j = 0; j < count; ++j)
+                    free_block(magazine[j]);
+                magazine.erase(magazine.begin(), magazine.begin()+count);
+                release_cached(count*bin_sizes_[bin]);
             }
         }
     }
-    /** Release all unused memory. */
-    void FreeAllUnused()
+
+    /** Limit the number of bytes kept cached for reuse. */
+    void SetMaxCachedBytes(size_t max_bytes)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
+        max_bytes_cached_ = max_bytes;
+        if (bytes_cached_.load() > max_bytes)
+            Trim(max_bytes);
+    }
+    /** The limit on the number of bytes kept cached for reuse. */
+    size_t MaxCachedBytes() const noexcept
+    {
+        return max_bytes_cached_.load();
+    }
+
+    /** Return a snapshot of the usage statistics. */
+    MemoryPoolStatistics GetStatistics()
+    {
+        MemoryPoolStatistics stats;
+        stats.bins.resize(bin_sizes_.size());
         for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
-            for (auto&& ptr : free_data_[bin])
-                do_free(ptr);
+            stats.bins[bin] = { bin_sizes_[bin], 0, 0, 0 };
+        for (size_t i = 0; i < num_shards_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+            {
+                stats.bins[bin].hits += shards_[i].hits[bin];
+                stats.bins[bin].misses += shards_[i].misses[bin];
+                stats.bins[bin].cached += shards_[i].free_data[bin].size();
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(depot_mutex_);
+            for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+                stats.bins[bin].cached += depot_[bin].size();
+        }
+        stats.bytes_live = bytes_live_.load();
+        stats.bytes_cached = bytes_cached_.load();
+        stats.peak_bytes_live = peak_bytes_live_.load();
+        stats.peak_bytes_total = peak_bytes_total_.load();
+        stats.oversize_allocations = oversize_allocations_.load();
+        stats.bytes_trimmed = bytes_trimmed_.load();
+        stats.max_bytes_cached = max_bytes_cached_.load();
+        return stats;
+    }
+    /** Print the usage statistics. */
+    void PrintStatistics(std::ostream& os)
+    {
+        os << (Pinned ? "Pinned host" : "Host") << " memory pool:\n";
+        PrintMemoryPoolStatistics(os, GetStatistics());
+    }
+    /** Reset the counters and restart the high-water marks. */
+    void ResetStatistics()
+    {
+        for (size_t i = 0; i < num_shards_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            shards_[i].hits.assign(bin_sizes_.size(), 0);
+            shards_[i].misses.assign(bin_sizes_.size(), 0);
+        }
+        peak_bytes_live_ = bytes_live_.load();
+        peak_bytes_total_ = bytes_live_.load() + bytes_cached_.load();
+        oversize_allocations_ = 0;
+        bytes_trimmed_ = 0;
     }
 
 private:
 
     /** Index of an invalid bin. */
     static constexpr size_t INVALID_BIN = (size_t) -1;
+    /** Upper bound on the number of per-thread shards. */
+    static constexpr size_t MAX_SHARDS = 64;
+    /** Alignment in bytes of the binned allocations. */
+    static constexpr size_t BLOCK_ALIGNMENT = 64;
+    /** Values of BlockHeader::tag for live and cached allocations. */
+    static constexpr std::uint64_t LIVE_TAG = 0x4c49564548594452;
+    static constexpr std::uint64_t FREE_TAG = 0x4652454548594452;
+
+    /** Stored immediately ahead of each binned allocation. */
+    struct BlockHeader
+    {
+        /** The pointer returned by do_allocation. */
+        void* base;
+        size_t bin;
+        std::uint64_t tag;
+    };
+
+    /** An allocation too large for any bin. */
+    struct OversizeBlock
+    {
+        /** The pointer returned by do_allocation. */
+        void* base;
+        size_t size;
+    };
+
+    /** A cached allocation in the depot. */
+    struct CachedBlock
+    {
+        void* ptr;
+        /** When the allocation was moved to the depot. */
+        size_t tick;
+    };
 
-    /** Serialize access from multiple threads. */
-    std::mutex mutex_;
+    /** Free lists used by the threads that map to one shard. */
+    struct Shard
+    {
+        std::mutex mutex;
+        std::vector<std::vector<void*>> free_data;
+        std::vector<size_t> hits;
+        std::vector<size_t> misses;
+        /** Keep shards on separate cache lines. */
+        char padding[64];
+    };
 
     /** Size in bytes of each bin. */
     std::vector<size_t> bin_sizes_;
-    /** Data available to allocate.
-     *  Each entry is a bin, and each bin has a vector of pointers to free
-     *  memory of that size.
+    /** Maximum number of cached allocations per bin in a shard. */
+    size_t magazine_size_;
+
+    /** Per-thread free lists. */
+    std::unique_ptr<Shard[]> shards_;
+    size_t num_shards_;
+
+    /** Live allocations too large for any bin. */
+    std::mutex oversize_mutex_;
+    std::unordered_map<void*, OversizeBlock> oversize_blocks_;
+
+    /** Serialize access to the depot. */
+    std::mutex depot_mutex_;
+    /** Data available to allocate that no shard is caching.
+     *  Each entry is a bin, and each bin holds pointers to free memory of
+     *  that size, from least to most recently cached.
      */
-    std::vector<std::vector<void*>> free_data_;
-    /** Map used pointers to the associated bin index. */
-    std::unordered_map<void*, size_t> alloc_to_bin_;
+    std::vector<std::deque<CachedBlock>> depot_;
+    /** Logical clock used to order the depot. */
+    size_t clock_ = 0;
+
+    /** Usage counters. */
+    std::atomic<size_t> bytes_live_{0};
+    std::atomic<size_t> bytes_cached_{0};
+    std::atomic<size_t> peak_bytes_live_{0};
+    std::atomic<size_t> peak_bytes_total_{0};
+    std::atomic<size_t> oversize_allocations_{0};
+    std::atomic<size_t> bytes_trimmed_{0};
+    std::atomic<size_t> max_bytes_cached_{
+        std::numeric_limits<size_t>::max()};
 
     /** Allocate size bytes. */
     inline void* do_allocation(size_t size);
@@ -164,15 +495,101 @@ private:
     inline void do_free(void* ptr);
 
     /** Return the bin index for size. */
-    inline size_t get_bin(size_t size)
+    inline size_t get_bin(size_t size) const
+    {
+        auto const iter =
+            std::lower_bound(bin_sizes_.cbegin(), bin_sizes_.cend(), size);
+        if (iter == bin_sizes_.cend())
+            return INVALID_BIN;
+        return iter - bin_sizes_.cbegin();
+    }
+
+    /** Return the shard of the calling thread. */
+    Shard& local_shard() noexcept
+    {
+        return shards_[details::ThisThreadIndex() & (num_shards_-1)];
+    }
+
+    /** Move up to half a magazine of allocations from the depot. */
+    void refill_magazine(size_t bin, std::vector<void*>& magazine)
+    {
+        std::lock_guard<std::mutex> lock(depot_mutex_);
+        auto& cached = depot_[bin];
+        size_t const count = std::min(cached.size(), magazine_size_/2);
+        for (size_t i = 0; i < count; ++i)
+        {
+            magazine.push_back(cached.back().ptr);
+            cached.pop_back();
+        }
+    }
+
+    /** Move the older half of a full magazine to the depot. */
+    void flush_magazine(size_t bin, std::vector<void*>& magazine)
+    {
+        size_t const count = magazine.size()/2;
+        std::lock_guard<std::mutex> lock(depot_mutex_);
+        for (size_t i = 0; i < count; ++i)
+            depot_[bin].push_back({magazine[i], clock_++});
+        magazine.erase(magazine.begin(), magazine.begin()+count);
+    }
+
+    /** Account for a live allocation of size bytes. */
+    void add_live(size_t size) noexcept
+    {
+        size_t const live = (bytes_live_ += size);
+        update_peak(peak_bytes_live_, live);
+        update_peak(peak_bytes_total_, live + bytes_cached_.load());
+    }
+
+    /** Account for size cached bytes that were released. */
+    void release_cached(size_t size) noexcept
+    {
+        bytes_cached_ -= size;
+        bytes_trimmed_ += size;
+    }
+
+    /** Raise peak to value if it is larger. */
+    static void update_peak(std::atomic<size_t>& peak, size_t value) noexcept
     {
-        // Assuming we don't have that many bins, just do a linear search.
-        // Could optimize with binary search if need be.
-        for (size_t i = 0; i < bin_sizes_.size(); ++i)
+        size_t current = peak.load();
+        while (value > current && !peak.compare_exchange_weak(current, value))
+        {}
+    }
+
+    /** Round ptr up to a multiple of BLOCK_ALIGNMENT. */
+    static void* align_up(void* ptr) noexcept
+    {
+        auto const addr = reinterpret_cast<std::uintptr_t>(ptr);
+        return reinterpret_cast<void*>(
+            (addr + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT);
+    }
+
+    /** Return the header of the binned allocation ptr. */
+    static BlockHeader& header(void* ptr) noexcept
+    {
+        return reinterpret_cast<BlockHeader*>(ptr)[-1];
+    }
+
+    /** Return the memory of the binned allocation ptr to the allocator. */
+    void free_block(void* ptr)
+    {
+        do_free(header(ptr).base);
+    }
+
+    /** Free the allocation ptr, which is too large for any bin. */
+    void free_oversize(void* ptr)
+    {
+        OversizeBlock block;
         {
-            if (bin_sizes_[i] >= size) return i;
+            std::lock_guard<std::mutex> lock(oversize_mutex_);
+            auto iter = oversize_blocks_.find(ptr);
+            if (iter == oversize_blocks_.end())
+                details::ThrowRuntimeError("Tried to free unknown ptr");
+            block = iter->second;
+            oversize_blocks_.erase(iter);
         }
-        return INVALID_BIN;
+        bytes_live_ -= block.size;
+        do_free(block.base);
     }
 
 };  // class MemoryPool
@@ -253,7 +670,10 @@ MemoryPool<true>& PinnedHostMemoryPool();
 /** Destroy singleton instance of CUDA pinned host memory pool. */
 void DestroyPinnedHostMemoryPool();
 #endif  // HYDROGEN_HAVE_GPU
-/** Get singleton instance of host memory pool. */
+/** Get singleton instance of host memory pool.
+ *  If H_MEMPOOL_MAX_CACHED_SIZE is set, the host memory pools cache at
+ *  most that many bytes.
+ */
 MemoryPool<false>& HostMemoryPool();
 /** Destroy singleton instance of host memory pool. */
 void DestroyHostMemoryPool();
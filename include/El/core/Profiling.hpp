@@ -2,7 +2,10 @@
 #ifndef EL_CORE_PROFILING_HPP_
 #define EL_CORE_PROFILING_HPP_
 
+#include <cstdint>
+#include <iosfwd>
 #include <string>
+#include <vector>
 
 #include "El-lite.hpp"
 #include "hydrogen/Device.hpp"
@@ -19,6 +22,114 @@ void DisableVTune() noexcept;
 void EnableNVProf() noexcept;
 void DisableNVProf() noexcept;
 
+/** \brief Enable the built-in trace recorder.
+ *
+ *  While tracing is enabled, the beginning and end of every profiling
+ *  region are timestamped and stored in a ring buffer owned by the
+ *  calling thread, so recording requires neither locks nor
+ *  communication. Once a buffer is full, its oldest events are
+ *  overwritten. When tracing is disabled, the only cost of a region is
+ *  a check of a flag.
+ *
+ *  Tracing can also be enabled by setting the environment variable
+ *  H_TRACE to a filename prefix before Initialize(), in which case
+ *  Finalize() writes the trace of each rank to "<prefix>.<rank>.json"
+ *  and prints the summary from rank 0.
+ *
+ *  \param eventsPerThread The capacity of the ring buffer of each
+ *      thread that has not yet recorded an event.
+ */
+void EnableRegionTracing(size_t eventsPerThread=(size_t(1) << 20)) noexcept;
+void DisableRegionTracing() noexcept;
+bool RegionTracingEnabled() noexcept;
+
+/** \brief Discard the recorded events.
+ *
+ *  No thread may be recording events concurrently.
+ */
+void ClearTrace() noexcept;
+
+/** \brief Write the events recorded on this rank in the Chrome trace
+ *      event format, which is understood by chrome://tracing and
+ *      Perfetto. The process id of the events is the rank in
+ *      MPI_COMM_WORLD.
+ */
+void WriteTrace(std::string const& filename);
+
+/** \brief Print the number of calls and the inclusive and exclusive
+ *      times of every traced region, reduced over the ranks.
+ *
+ *  This is collective over MPI_COMM_WORLD; only rank 0 prints.
+ */
+void PrintTraceSummary(std::ostream& os);
+
+/** \brief Enable the accounting of the communication issued through the
+ *      mpi:: wrappers.
+ *
+ *  While enabled, every blocking collective and point-to-point call
+ *  records its wall time and the number of bytes in its send and
+ *  receive buffers, attributed to the communicator and to the innermost
+ *  profiling region open on the calling thread. When disabled, the only
+ *  cost of a call is a check of a flag. Nonblocking calls are not
+ *  recorded.
+ *
+ *  The wall time is measured on the host around the call. Calls that
+ *  are dispatched to Aluminum, e.g. on GPU buffers, return once the
+ *  operation is enqueued on the stream, so their times are enqueue times
+ *  rather than the times of the communication itself.
+ *
+ *  The statistics can also be enabled by setting the environment
+ *  variable H_COMM_STATS before Initialize(), in which case Finalize()
+ *  prints the report from rank 0.
+ */
+void EnableCommStats() noexcept;
+void DisableCommStats() noexcept;
+bool CommStatsEnabled() noexcept;
+
+/** \brief Discard the recorded statistics.
+ *
+ *  No thread may be communicating concurrently.
+ */
+void ClearCommStats() noexcept;
+
+/** \brief The communication recorded on one rank for a single operation
+ *      over a single communicator within a single profiling region.
+ */
+struct CommStats
+{
+    /** \brief The innermost open profiling region, or an empty string. */
+    std::string region;
+    /** \brief The name of the wrapper, e.g. "AllGather". */
+    std::string operation;
+    /** \brief The name of the communicator (see mpi::SetName), or an
+     *      empty string if it has none.
+     */
+    std::string comm;
+    int commSize = 0;
+
+    std::uint64_t calls = 0;
+    /** \brief The total size of the send and receive buffers. */
+    std::uint64_t bytes = 0;
+    /** \brief The total wall time in seconds (only the time to enqueue
+     *      the operations dispatched to Aluminum; see EnableCommStats).
+     */
+    double time = 0.;
+    /** \brief Entry b counts the calls that moved between 2^(b-1) and
+     *      2^b-1 bytes; entry 0 counts the calls that moved nothing.
+     */
+    std::vector<std::uint64_t> sizeHistogram;
+};
+
+/** \brief The statistics recorded on this rank by all threads. */
+std::vector<CommStats> GetCommStats();
+
+/** \brief Print the calls, volume, message sizes and times of every
+ *      operation, summed over the ranks that issued it.
+ *
+ *  This is collective over MPI_COMM_WORLD; only rank 0 prints.
+ */
+void PrintCommStatsReport(std::ostream& os);
+
 /** \brief A selection of colors to use with the profiling interface.
  *
  *  It seems unlikely that a user will ever need to access these by
@@ -180,6 +180,11 @@ void Trrk
         dcomplex beta,
         dcomplex* C, BlasInt CLDim );
 
+// Sets the number of threads that MKL may use on the calling thread and returns
+// the previous thread-local setting (zero if the global setting was in use).
+// Passing zero reverts the calling thread to the global setting.
+int SetNumThreadsLocal( int numThreads );
+
 } // namespace mkl
 } // namespace El
 #endif // ifdef HYDROGEN_HAVE_MKL
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <string>
 #include <vector>
 
 namespace El
@@ -241,6 +242,8 @@ void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm const& comm1, Comm const& comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm const& comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
+// Label the communicator in the communication statistics and in MPI tools
+void SetName( Comm const& comm, std::string const& name ) EL_NO_RELEASE_EXCEPT;
 bool CongruentToCommSelf( Comm const& comm ) EL_NO_RELEASE_EXCEPT;
 bool CongruentToCommWorld( Comm const& comm ) EL_NO_RELEASE_EXCEPT;
 
@@ -828,6 +831,29 @@ void IGather
         T* rbuf, int rc, int root, Comm const& comm,
   Request<T>& request );
 
+// Non-blocking all-gather
+// -----------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm const& comm,
+  Request<Complex<Real>>& request );
+// NOTE: Types which must be serialized fall back to a blocking all-gather
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm const& comm,
+  Request<T>& request );
+
 // Gather with variable recv sizes
 // -------------------------------
 template <typename Real, Device D,
@@ -1492,6 +1518,26 @@ void ReduceScatter(T* buf, int rc, Comm const& comm, SyncInfo<D> const&);
 #undef COLLECTIVE_SIGNATURE
 #undef COLL // Collective::REDUCESCATTER
 
+// Non-blocking ReduceScatter (summation)
+// ---------------------------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Comm const& comm,
+  Request<Complex<Real>>& request );
+// NOTE: Types which must be serialized fall back to a blocking ReduceScatter
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm const& comm,
+  Request<T>& request );
+
 // Variable-length ReduceScatter
 // -----------------------------
 template <typename Real, Device D,
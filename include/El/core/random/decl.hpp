@@ -112,6 +112,47 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>>
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random numbers
+// ============================
+// The Philox4x32-10 generator of Salmon et al., "Parallel random numbers: As
+// easy as 1, 2, 3", maps a 128-bit counter and a 64-bit key to 128 random
+// bits. Keying a stream once and using the global indices of a matrix entry
+// as the counter allows every process and thread to generate its entries
+// independently, with results that do not depend upon the distribution.
+typedef std::array<std::uint32_t,4> PhiloxCounter;
+typedef std::array<std::uint32_t,2> PhiloxKey;
+
+inline PhiloxCounter Philox4x32( PhiloxCounter counter, PhiloxKey key );
+
+// The random bits for entry (i,j) of the stream with the given key
+inline PhiloxCounter PhiloxBits( const PhiloxKey& key, Int i, Int j );
+
+// Return the key of the next stream of the grid, which every process that
+// views the grid must key, in the same order, but without communicating.
+// Streams are numbered per grid from the last InitializeRandom, so draws on
+// different grids do not affect each other, and the first draws on any two
+// grids use the same streams.
+PhiloxKey NewPhiloxKey( const Grid& grid );
+
+// The types for which samples can be formed from the bits of a single Philox
+// block
+template<typename T> struct IsPhiloxSampleable : std::false_type {};
+template<> struct IsPhiloxSampleable<float> : std::true_type {};
+template<> struct IsPhiloxSampleable<double> : std::true_type {};
+template<typename Real>
+struct IsPhiloxSampleable<Complex<Real>> : IsPhiloxSampleable<Real> {};
+
+// Analogues of SampleBall and SampleNormal that consume a Philox block
+template<typename F,typename=EnableIf<IsComplex<F>>>
+F SamplePhiloxBall
+( const F& center, const Base<F>& radius, const PhiloxCounter& bits );
+template<typename Real,typename=DisableIf<IsComplex<Real>>,typename=void>
+Real SamplePhiloxBall
+( const Real& center, const Real& radius, const PhiloxCounter& bits );
+template<typename F>
+F SamplePhiloxNormal
+( const F& mean, const Base<F>& stddev, const PhiloxCounter& bits );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
@@ -230,6 +230,93 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(Real(center-radius),Real(center+radius)); }
 
+inline PhiloxCounter Philox4x32( PhiloxCounter counter, PhiloxKey key )
+{
+    const std::uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+    const std::uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+    for( int round=0; round<10; ++round )
+    {
+        const std::uint64_t p0 = std::uint64_t(M0)*counter[0];
+        const std::uint64_t p1 = std::uint64_t(M1)*counter[2];
+        counter =
+          {{ std::uint32_t(p1>>32)^counter[1]^key[0], std::uint32_t(p1),
+             std::uint32_t(p0>>32)^counter[3]^key[1], std::uint32_t(p0) }};
+        key[0] += W0;
+        key[1] += W1;
+    }
+    return counter;
+}
+
+inline PhiloxCounter PhiloxBits( const PhiloxKey& key, Int i, Int j )
+{
+    const std::uint64_t iBits = std::uint64_t(i);
+    const std::uint64_t jBits = std::uint64_t(j);
+    return Philox4x32
+      ({{ std::uint32_t(iBits), std::uint32_t(iBits>>32),
+          std::uint32_t(jBits), std::uint32_t(jBits>>32) }}, key);
+}
+
+namespace philox {
+
+// A sample from [0,1) formed from the leading bits of 64 random bits
+template<typename Real>
+Real UnitUniform( std::uint32_t hi, std::uint32_t lo );
+template<>
+inline float UnitUniform( std::uint32_t hi, std::uint32_t )
+{ return float(hi>>8)*(1.f/16777216.f); }
+template<>
+inline double UnitUniform( std::uint32_t hi, std::uint32_t lo )
+{
+    const std::uint64_t bits = (std::uint64_t(hi)<<32) | lo;
+    return double(bits>>11)*(1./9007199254740992.);
+}
+
+} // namespace philox
+
+// These follow the conventions of SampleBall, e.g., the radius of a complex
+// sample (rather than its square) is uniformly distributed.
+template<typename F,typename>
+F SamplePhiloxBall
+( const F& center, const Base<F>& radius, const PhiloxCounter& bits )
+{
+    typedef Base<F> Real;
+    const Real r = radius*philox::UnitUniform<Real>(bits[0],bits[1]);
+    const Real angle = 2*Pi<Real>()*philox::UnitUniform<Real>(bits[2],bits[3]);
+    return center + F(r*Cos(angle),r*Sin(angle));
+}
+
+template<typename Real,typename,typename>
+Real SamplePhiloxBall
+( const Real& center, const Real& radius, const PhiloxCounter& bits )
+{
+    const Real u = philox::UnitUniform<Real>(bits[0],bits[1]);
+    return center + radius*(2*u-1);
+}
+
+// The Box-Muller transform turns the two uniform samples within a block into
+// a pair of independent normal samples
+template<typename F>
+F SamplePhiloxNormal
+( const F& mean, const Base<F>& stddev, const PhiloxCounter& bits )
+{
+    typedef Base<F> Real;
+    Real stddevAdj = stddev;
+    if( IsComplex<F>::value )
+        stddevAdj /= Sqrt(Real(2));
+
+    // Use 1-u, which lies in (0,1], to avoid the logarithm of zero
+    const Real u = 1 - philox::UnitUniform<Real>(bits[0],bits[1]);
+    const Real v = philox::UnitUniform<Real>(bits[2],bits[3]);
+    const Real r = stddevAdj*Sqrt(-2*Log(u));
+    const Real angle = 2*Pi<Real>()*v;
+
+    F sample;
+    SetRealPart( sample, RealPart(mean) + r*Cos(angle) );
+    if( IsComplex<F>::value )
+        SetImagPart( sample, ImagPart(mean) + r*Sin(angle) );
+    return sample;
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
@@ -96,17 +96,25 @@ enum HermitianTridiagApproach
 {
     HERMITIAN_TRIDIAG_NORMAL, // Keep the current grid
     HERMITIAN_TRIDIAG_SQUARE, // Drop to a square process grid
-    HERMITIAN_TRIDIAG_DEFAULT // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_DEFAULT, // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_TWO_STAGE // Reduce through a band (see TwoStage below)
 };
 }
 using namespace HermitianTridiagApproachNS;
 
+// The two-stage approach is only used by herm_tridiag::ExplicitCondensed,
+// e.g., when HermitianEig does not compute eigenvectors. Since
+// herm_tridiag::ApplyQ requires the reflectors of a one-stage reduction,
+// HermitianTridiag falls back to the default approach in its place.
 template<typename Field>
 struct HermitianTridiagCtrl
 {
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // The bandwidth of the two-stage approach; zero selects the blocksize
+    Int bandwidth=0;
 };
 
 template<typename Field>
@@ -141,6 +149,79 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Two-stage reduction
+// -------------------
+// The lower triangle of A is first reduced to a Hermitian band with level-3
+// updates, and the band is then reduced to tridiagonal form by chasing bulges;
+// see
+//
+//   C. Bischof, B. Lang, and X. Sun, "A framework for symmetric band
+//   reduction", ACM Trans. Math. Softw., 26 (2000), pp. 581--601,
+//
+// and
+//
+//   A. Haidar, H. Ltaief, and J. Dongarra, "Parallel reduction to condensed
+//   forms for symmetric eigenvalue problems using aggregated fine-grained and
+//   memory-aware kernels", Proc. SC'11.
+//
+// On exit, the diagonal and subdiagonal of A hold the (real) tridiagonal
+// matrix and the reflectors of the first stage are packed below the band.
+
+// The reflectors generated while chasing the bulges, in the order in which
+// they were generated. The k'th reflector acts on rows
+// [offsets(k),offsets(k)+bandwidth) (clipped to the matrix) and the first
+// entry of each column of V is an explicit one.
+//
+// There are roughly n^2/(2 bandwidth) reflectors, so V holds about n^2/2
+// entries.
+//
+// Only the first stage is distributed. In the distributed case the band is
+// summed onto every process, which then performs the entire chase itself, so
+// the second stage takes O(n^2 bandwidth) work and, with the reflectors,
+// O(n^2) memory on each process regardless of the number of processes. (The
+// two-stage approach of ExplicitCondensed discards the reflectors and only
+// needs the O(n bandwidth) memory of the band.)
+template<typename Field>
+struct BandReflectors
+{
+    Int bandwidth=0;
+    Matrix<Field> V;
+    Matrix<Field> householderScalars;
+    Matrix<Int> offsets;
+};
+
+// A bandwidth of zero selects the algorithmic blocksize
+template<typename Field>
+void TwoStage
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  BandReflectors<Field>& bandReflectors,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  BandReflectors<Field>& bandReflectors,
+  Int bandwidth=0 );
+
+// Applies the unitary matrix from the left of a two-stage reduction. The
+// chase's reflectors are applied in compact WY blocks of consecutive sweeps;
+// in the distributed case, to the local columns of a [* ,VR] copy of B.
+template<typename Field>
+void ApplyQ
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const BandReflectors<Field>& bandReflectors,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyQ
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const BandReflectors<Field>& bandReflectors,
+        AbstractDistMatrix<Field>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -18,12 +18,27 @@ namespace El {
 
 // Cholesky
 // ========
+struct CholeskyCtrl
+{
+    bool scalapack=false;
+
+    // The lookahead depth d. Each factored panel immediately updates only the
+    // next d block columns (rows, if upper), and its update of the rest of
+    // the trailing matrix is deferred until d more panels are factored. The
+    // redistribution of each panel is nonblocking and overlaps the deferred
+    // updates. Zero disables the lookahead.
+    Int lookahead=0;
+};
+
 template<typename Field>
 void Cholesky( UpperOrLower uplo, AbstractMatrix<Field>& A );
 template<typename Field>
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool scalapack=false );
 template<typename Field>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<Field>& A, const CholeskyCtrl& ctrl );
+template<typename Field>
 void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
 
 template<typename Field>
@@ -293,10 +308,22 @@ void LU( DistMatrix<Field,STAR,STAR>& A );
 
 // LU with partial pivoting
 // ------------------------
+struct LUCtrl
+{
+    // Whether to choose all of the pivots of each panel at once with a
+    // tournament over the process column (CALU) rather than with one
+    // reduction per column. The pivots usually differ from those of partial
+    // pivoting, but the factorization is comparably stable in practice.
+    bool tournament=false;
+};
+
 template<typename Field>
 void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
+template<typename Field>
+void LU
+( AbstractDistMatrix<Field>& A, DistPermutation& P, const LUCtrl& ctrl );
 
 // LU with full pivoting
 // ---------------------
@@ -463,6 +490,15 @@ void Explicit( AbstractDistMatrix<Field>& L, AbstractDistMatrix<Field>& A );
 // QR factorization
 // ================
 
+namespace TSQRTreeNS {
+enum TSQRTree
+{
+    TSQR_BINARY_TREE,
+    TSQR_FLAT_TREE
+};
+}
+using namespace TSQRTreeNS;
+
 template<typename Real>
 struct QRCtrl
 {
@@ -698,6 +734,19 @@ void Scatter( AbstractDistMatrix<Field>& A, const TreeData<Field>& treeData );
 
 } // namespace ts
 
+// Communication-avoiding QR (CAQR)
+// --------------------------------
+// Each panel is factored with a TSQR reduction over the process column, for
+// any number of processes, rather than with one reduction per column. The
+// Householder form of each panel is then reconstructed, so that the result
+// may be used with qr::ApplyQ and qr::SolveAfter as if it came from QR.
+template<typename Field>
+void CA
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Base<Field>>& signature,
+  TSQRTree tree=TSQR_BINARY_TREE );
+
 } // namespace qr
 
 // RQ
@@ -868,6 +917,75 @@ void Skeleton
         AbstractDistMatrix<Field>& Z,
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>() );
 
+// Randomized range finder
+// =======================
+// Overwrites Q with numCols orthonormal columns whose span approximates the
+// range of A by orthonormalizing A Omega for a random n x numCols sketch,
+// Omega, optionally followed by power (subspace) iterations which
+// re-orthonormalize after every application of A or A^H; see
+//
+//   N. Halko, P. G. Martinsson, and J. A. Tropp,
+//   "Finding structure with randomness: Probabilistic algorithms for
+//   constructing approximate matrix decompositions",
+//   SIAM Review, 53 (2011), pp. 217--288.
+//
+
+namespace RangeFinderSketchNS {
+enum RangeFinderSketch
+{
+    GAUSSIAN_SKETCH,
+    RADEMACHER_SKETCH
+};
+}
+using namespace RangeFinderSketchNS;
+
+struct RangeFinderCtrl
+{
+    RangeFinderSketch sketch=GAUSSIAN_SKETCH;
+
+    // Each power iteration applies A^H and A once more, which sharpens the
+    // approximation when the singular values of A decay slowly
+    Int numPowerIts=0;
+};
+
+template<typename Field>
+void RangeFinder
+( const Matrix<Field>& A,
+        Matrix<Field>& Q,
+        Int numCols,
+  const RangeFinderCtrl& ctrl=RangeFinderCtrl() );
+template<typename Field>
+void RangeFinder
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& Q,
+        Int numCols,
+  const RangeFinderCtrl& ctrl=RangeFinderCtrl() );
+
+// Randomized SVD
+// ==============
+// Returns an approximation of the leading 'rank' singular triplets of A,
+// A ~= U diag(s) V^H, in O(m n (rank+oversample)) work. The range of A is
+// first captured with rank+oversample columns using RangeFinder, so that only
+// a small QR and SVD of the sketch remain.
+template<typename Field>
+void RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+        Int oversample=10,
+  const RangeFinderCtrl& ctrl=RangeFinderCtrl() );
+template<typename Field>
+void RandomizedSVD
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+        Int rank,
+        Int oversample=10,
+  const RangeFinderCtrl& ctrl=RangeFinderCtrl() );
+
 } // namespace El
 
 #include <El/lapack_like/factor/qr/ProxyHouseholder.hpp>
@@ -169,6 +169,62 @@ void Overwrite
 
 } // namespace hpd_solve
 
+// Mixed-precision Hermitian Positive-Definite
+// ===========================================
+// A copy of A is factored in single precision and the solution is then
+// iteratively refined using residuals computed in the precision of A. If A,
+// B, or a residual has entries that overflow in single precision, the
+// single-precision factorization breaks down, the backward error is not
+// finite, or the refinement stalls before reaching the requested backward
+// error, A is instead factored in its own precision.
+
+template<typename Real>
+struct MixedPrecisionHPDSolveCtrl
+{
+    // The normwise backward error,
+    //
+    //   || B - A X ||_F / ( || A ||_F || X ||_F + || B ||_F ),
+    //
+    // at which refinement stops. If zero, sqrt(n) epsilon is used, as in
+    // LAPACK's {d,z}{po,sy}sv.
+    Real relTol=0;
+    Int maxRefineIts=30;
+
+    // Refinement is considered to have stalled once an iteration fails to
+    // reduce the backward error by at least this factor
+    Real stallRatio=Real(0.5);
+
+    // Whether to fall back to a factorization in the precision of A when
+    // refinement fails to converge
+    bool fallback=true;
+};
+
+template<typename Real>
+struct MixedPrecisionHPDSolveInfo
+{
+    Int numRefineIts=0;
+    Real backwardError=0;
+    bool converged=false;
+    bool usedFallback=false;
+};
+
+template<typename Field>
+MixedPrecisionHPDSolveInfo<Base<Field>> MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl=
+        MixedPrecisionHPDSolveCtrl<Base<Field>>() );
+template<typename Field>
+MixedPrecisionHPDSolveInfo<Base<Field>> MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl=
+        MixedPrecisionHPDSolveCtrl<Base<Field>>() );
+
 // Multi-shift Hessenberg
 // ======================
 template<typename Field>
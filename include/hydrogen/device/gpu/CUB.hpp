@@ -10,16 +10,40 @@
 #include <hipcub/hipcub.hpp>
 #endif // HYDROGEN_HAVE_CUB
 
+#include <cstddef>
+#include <ostream>
+
 namespace hydrogen
 {
 namespace cub
 {
 #ifdef HYDROGEN_HAVE_CUDA
 namespace cub_impl = ::cub;
+using ErrorType = cudaError_t;
+using StreamType = cudaStream_t;
 #elif defined HYDROGEN_HAVE_ROCM
 namespace cub_impl = ::hipcub;
+using ErrorType = hipError_t;
+using StreamType = hipStream_t;
 #endif // HYDROGEN_HAVE_CUDA
 
+    /** @brief Usage statistics of the CUB memory pool on one device. */
+    struct MemoryPoolStatistics
+    {
+        /** Bytes handed out and not yet freed. */
+        size_t bytes_live = 0;
+        /** Bytes held for reuse. */
+        size_t bytes_cached = 0;
+        /** High-water mark of bytes_live. */
+        size_t peak_bytes_live = 0;
+        /** Number of allocations made through Allocate(). */
+        size_t allocations = 0;
+        /** Allocations that were served from cached memory. */
+        size_t cache_hits = 0;
+        /** Limit on bytes_cached. */
+        size_t max_bytes_cached = 0;
+    };
+
     /** @brief Get singleton instance of CUB memory pool.
      *
      *  A new memory pool is constructed if one doesn't exist
@@ -42,6 +66,24 @@ namespace cub_impl = ::hipcub;
     /** Destroy singleton instance of CUB memory pool. */
     void DestroyMemoryPool();
 
+    /** @brief Allocate from the CUB memory pool on the current device,
+     *         recording usage statistics.
+     */
+    ErrorType Allocate(void** ptr, size_t bytes, StreamType stream);
+    /** @brief Return memory obtained from Allocate() to the pool. */
+    ErrorType Free(void* ptr);
+
+    /** @brief Usage statistics of the pool on the current device. */
+    MemoryPoolStatistics GetMemoryPoolStatistics();
+    /** @brief Print the usage statistics of the pool on the current
+     *         device.
+     */
+    void PrintMemoryPoolStatistics(std::ostream& os);
+    /** @brief Limit the aggregate cached bytes per device. Cached
+     *         blocks beyond the limit are released when freed.
+     */
+    void SetMaxCachedBytes(size_t bytes);
+
 } // namespace cub
 } // namespace hydrogen
 
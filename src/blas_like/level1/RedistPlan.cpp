@@ -0,0 +1,236 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/core/Profiling.hpp>
+
+namespace El {
+
+namespace {
+
+// List the local entries of a width x height local matrix that are
+// exchanged with each process, where forEachPeer(iLoc,jLoc,func) calls func
+// with the VC rank of every process that the entry is exchanged with. The
+// entries that this process exchanges with itself are listed separately.
+//
+// Both sides of an exchange traverse their entries in column-major order of
+// the global indices, so that the entries received from each process arrive
+// in the order in which they are listed.
+template<typename PeerFunc>
+void ListEntries
+( Int localHeight, Int localWidth, int commSize, int commRank,
+  PeerFunc forEachPeer,
+  vector<Int>& rows, vector<Int>& cols,
+  vector<int>& counts, vector<int>& offs,
+  vector<Int>& selfRows, vector<Int>& selfCols )
+{
+    counts.assign( commSize, 0 );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            forEachPeer( iLoc, jLoc, [&]( int q ) { ++counts[q]; } );
+    const Int numSelf = counts[commRank];
+    counts[commRank] = 0;
+    offs.resize( commSize );
+    const Int numEntries = Scan( counts, offs );
+
+    rows.resize( numEntries );
+    cols.resize( numEntries );
+    selfRows.resize( numSelf );
+    selfCols.resize( numSelf );
+    auto entryOffs = offs;
+    Int selfOff = 0;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            forEachPeer
+            ( iLoc, jLoc,
+              [&]( int q )
+              {
+                  if( q == commRank )
+                  {
+                      selfRows[selfOff] = iLoc;
+                      selfCols[selfOff] = jLoc;
+                      ++selfOff;
+                  }
+                  else
+                  {
+                      rows[entryOffs[q]] = iLoc;
+                      cols[entryOffs[q]] = jLoc;
+                      ++entryOffs[q];
+                  }
+              } );
+}
+
+} // anonymous namespace
+
+template<typename T>
+RedistPlan<T>::RedistPlan
+( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B )
+: ADist_(A.DistData()), BDist_(B.DistData()),
+  height_(A.Height()), width_(A.Width())
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A, B );
+    if( A.GetLocalDevice() != Device::CPU ||
+        B.GetLocalDevice() != Device::CPU )
+        LogicError("RedistPlan only supports matrices on the CPU");
+
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    const int commSize = g.Size();
+    const int commRank = g.VCRank();
+
+    // The distribution and cross ranks of each process within A, so that
+    // the processes that own an entry of A can be recognized
+    const Dist AColDist = A.ColDist(), ARowDist = A.RowDist();
+    const int ARoot = A.Root();
+    const int ARedundantSize = A.RedundantSize();
+    vector<int> ADistRanks( commSize ), ACrossRanks( commSize );
+    for( int distRank=0; distRank<A.DistSize(); ++distRank )
+        for( int crossRank=0; crossRank<A.CrossSize(); ++crossRank )
+            for( int redundant=0; redundant<ARedundantSize; ++redundant )
+            {
+                const int q =
+                  g.CoordsToVC
+                  ( AColDist, ARowDist, distRank, crossRank, redundant );
+                ADistRanks[q] = distRank;
+                ACrossRanks[q] = crossRank;
+            }
+
+    // Entry (i,j) of B on process q is read from the copy of A on q if
+    // there is one and is otherwise read from the copy whose redundant rank
+    // is q modulo the number of copies, which spreads the reads of
+    // redundantly-distributed sources over all of their copies
+    auto source = [&]( Int i, Int j, int q )
+    {
+        const int distOwner = A.Owner( i, j );
+        if( ADistRanks[q] == distOwner && ACrossRanks[q] == ARoot )
+            return q;
+        return g.CoordsToVC
+          ( AColDist, ARowDist, distOwner, ARoot, q % ARedundantSize );
+    };
+
+    // B may not yet have been resized, so its local entries are determined
+    // from its shifts rather than from its local matrix
+    const Dist BColDist = B.ColDist(), BRowDist = B.RowDist();
+    const int BRoot = B.Root();
+    const int BRedundantSize = B.RedundantSize();
+    const bool BParticipating = B.Participating();
+    const Int BColShift = B.ColShift(), BRowShift = B.RowShift();
+    const Int BColStride = B.ColStride(), BRowStride = B.RowStride();
+    const Int BLocalHeight =
+      ( BParticipating ? Length(height_,BColShift,BColStride) : 0 );
+    const Int BLocalWidth =
+      ( BParticipating ? Length(width_,BRowShift,BRowStride) : 0 );
+
+    const bool AParticipating = A.Participating();
+    ListEntries
+    ( ( AParticipating ? A.LocalHeight() : 0 ),
+      ( AParticipating ? A.LocalWidth() : 0 ),
+      commSize, commRank,
+      [&]( Int iLoc, Int jLoc, auto func )
+      {
+          const Int i = A.GlobalRow(iLoc);
+          const Int j = A.GlobalCol(jLoc);
+          const int distOwner = B.Owner( i, j );
+          for( int redundant=0; redundant<BRedundantSize; ++redundant )
+          {
+              const int q =
+                g.CoordsToVC
+                ( BColDist, BRowDist, distOwner, BRoot, redundant );
+              if( source( i, j, q ) == commRank )
+                  func( q );
+          }
+      },
+      sendRows_, sendCols_, sendCounts_, sendOffs_, copyARows_, copyACols_ );
+    ListEntries
+    ( BLocalHeight, BLocalWidth, commSize, commRank,
+      [&]( Int iLoc, Int jLoc, auto func )
+      {
+          const Int i = BColShift + iLoc*BColStride;
+          const Int j = BRowShift + jLoc*BRowStride;
+          func( source( i, j, commRank ) );
+      },
+      recvRows_, recvCols_, recvCounts_, recvOffs_, copyBRows_, copyBCols_ );
+
+    sendBuf_.resize( sendRows_.size() );
+    recvBuf_.resize( recvRows_.size() );
+
+    // Redistributions that only copy locally, e.g., from [* ,* ], need no
+    // exchange at all
+    SyncInfo<Device::CPU> syncInfo;
+    const int numExchanged = int( sendRows_.size() + recvRows_.size() > 0 );
+    exchange_ =
+      ( mpi::AllReduce( numExchanged, mpi::MAX, g.VCComm(), syncInfo ) != 0 );
+}
+
+template<typename T>
+bool RedistPlan<T>::Matches
+( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B ) const
+{
+    EL_DEBUG_CSE
+    return A.Height() == height_ && A.Width() == width_ &&
+           A.DistData() == ADist_ && B.DistData() == BDist_;
+}
+
+template<typename T>
+void RedistPlan<T>::Apply( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    AUTO_PROFILE_REGION("RedistPlan.Apply", SyncInfo<Device::CPU>{});
+    if( !Matches( A, B ) )
+        LogicError
+        ("A and B do not match the plan: \n",
+         DimsString(A,"A"),"\n",DimsString(B,"B"));
+    B.Resize( height_, width_ );
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+
+    const Int numSend = sendRows_.size();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numSend; ++k )
+        sendBuf_[k] = ABuf[sendRows_[k]+sendCols_[k]*ALDim];
+
+    const Int numCopy = copyARows_.size();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numCopy; ++k )
+        BBuf[copyBRows_[k]+copyBCols_[k]*BLDim] =
+          ABuf[copyARows_[k]+copyACols_[k]*ALDim];
+
+    if( !exchange_ )
+        return;
+    SyncInfo<Device::CPU> syncInfo;
+    mpi::AllToAll
+    ( sendBuf_.data(), sendCounts_.data(), sendOffs_.data(),
+      recvBuf_.data(), recvCounts_.data(), recvOffs_.data(),
+      g.VCComm(), syncInfo );
+
+    const Int numRecv = recvRows_.size();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numRecv; ++k )
+        BBuf[recvRows_[k]+recvCols_[k]*BLDim] = recvBuf_[k];
+}
+
+#define PROTO(T) template class RedistPlan<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,130 @@
+// MUST include this
+#include <catch2/catch.hpp>
+
+// File being tested
+#include <El.hpp>
+
+#include <vector>
+
+using namespace El;
+
+namespace
+{
+
+template <typename T>
+T Entry(Int i, Int seed)
+{
+    return T(float((i*7+seed) % 23));
+}
+
+template <typename T>
+void CheckStridedVectorCopy(Int destStride, Int sourceStride, Int numEntries)
+{
+    const T pad = T(-1);
+    std::vector<T> source(sourceStride*numEntries+2),
+        dest(destStride*numEntries+2, pad);
+    for (size_t i=0; i<source.size(); ++i)
+        source[i] = Entry<T>(i, 1);
+
+    // Start one entry in so that the unit-stride copies are misaligned
+    copy::util::StridedVectorCopy(
+        dest.data()+1, destStride, source.data()+1, sourceStride,
+        numEntries);
+    for (Int i=0; i<Int(dest.size()); ++i)
+    {
+        const Int offset = i-1;
+        if (offset >= 0 && offset % destStride == 0 &&
+            offset/destStride < numEntries)
+            REQUIRE(dest[i] == source[1+(offset/destStride)*sourceStride]);
+        else
+            REQUIRE(dest[i] == pad);
+    }
+}
+
+// Packs a column-distributed matrix with ColStridedPack and compares against
+// packing each column of each portion separately, then checks that
+// ColStridedUnpack restores the original entries
+template <typename T>
+void CheckColStridedPack(Int height, Int width, Int colAlign, Int colStride)
+{
+    const T pad = T(-1);
+    SyncInfo<Device::CPU> syncInfo;
+    const Int ALDim = height+3;
+    const Int portionSize = MaxLength(height, colStride)*width;
+    std::vector<T> A(ALDim*width);
+    for (size_t i=0; i<A.size(); ++i)
+        A[i] = Entry<T>(i, 2);
+
+    std::vector<T> portions(colStride*portionSize, pad),
+        portionsRef(colStride*portionSize, pad);
+    for (Int k=0; k<colStride; ++k)
+    {
+        const Int colShift = Shift_(k, colAlign, colStride);
+        const Int localHeight = Length_(height, colShift, colStride);
+        for (Int j=0; j<width; ++j)
+            for (Int i=0; i<localHeight; ++i)
+                portionsRef[k*portionSize+j*localHeight+i] =
+                  A[colShift+i*colStride+j*ALDim];
+    }
+    copy::util::ColStridedPack(
+        height, width, colAlign, colStride,
+        A.data(), ALDim, portions.data(), portionSize, syncInfo);
+    for (Int l=0; l<colStride*portionSize; ++l)
+        REQUIRE(portions[l] == portionsRef[l]);
+
+    const Int BLDim = height+5;
+    std::vector<T> B(BLDim*width, pad);
+    copy::util::ColStridedUnpack(
+        height, width, colAlign, colStride,
+        portions.data(), portionSize, B.data(), BLDim, syncInfo);
+    for (Int j=0; j<width; ++j)
+        for (Int i=0; i<BLDim; ++i)
+            REQUIRE(B[i+j*BLDim] == (i < height ? A[i+j*ALDim] : pad));
+}
+
+}// namespace <anon>
+
+TEST_CASE("Testing the CPU packing kernels","[copy][pack]")
+{
+    SECTION("PackFor calls the body once for each index")
+    {
+        // Below and above the size at which the calls are threaded
+        for (Int numEntries : { Int(10), Int(1) << 20 })
+        {
+            const Int n = 37;
+            std::vector<int> calls(n, 0);
+            copy::util::PackFor(
+                n, numEntries, [&](Int t) { calls[t] += 1; });
+            for (Int t=0; t<n; ++t)
+                REQUIRE(calls[t] == 1);
+        }
+    }
+
+    SECTION("StridedVectorCopy handles unit and odd strides")
+    {
+        for (Int destStride : { 1, 3, 5 })
+            for (Int sourceStride : { 1, 3, 7 })
+                for (Int numEntries : { 0, 1, 13, 1001 })
+                {
+                    CheckStridedVectorCopy<double>(
+                        destStride, sourceStride, numEntries);
+                    CheckStridedVectorCopy<Complex<float>>(
+                        destStride, sourceStride, numEntries);
+                }
+    }
+
+    SECTION("ColStridedPack/Unpack match the per-column copies")
+    {
+        for (Int colStride : { 1, 3, 7 })
+            for (Int colAlign=0; colAlign<colStride; colAlign+=2)
+                for (Int width : { 1, 2, 9 })
+                    for (Int height : { 1, 6, 37 })
+                        CheckColStridedPack<double>(
+                            height, width, colAlign, colStride);
+
+        // Large enough that the columns are spread over threads
+        CheckColStridedPack<double>(2049, 11, 4, 5);
+        CheckColStridedPack<Complex<double>>(1999, 13, 2, 3);
+        CheckColStridedPack<double>(20001, 1, 1, 3);
+    }
+}
@@ -0,0 +1,270 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level2.hpp>
+#include <El/core/Profiling.hpp>
+
+namespace El {
+
+namespace {
+
+// List the local rows that are exchanged with each process, where
+// forEachPeer(kLoc,func) calls func with the rank of every process that the
+// kLoc'th local row is exchanged with. The rows are traversed in increasing
+// order on both sides of an exchange, so that the entries received from each
+// process arrive in the order in which they are listed.
+template<typename PeerFunc>
+void ListRows
+( Int numRows, int commSize, Int width, PeerFunc forEachPeer,
+  vector<Int>& rows, vector<int>& counts, vector<int>& offs )
+{
+    vector<Int> rowCounts( commSize, 0 );
+    for( Int kLoc=0; kLoc<numRows; ++kLoc )
+        forEachPeer( kLoc, [&]( int q ) { ++rowCounts[q]; } );
+    vector<Int> rowOffs( commSize, 0 );
+    for( int q=1; q<commSize; ++q )
+        rowOffs[q] = rowOffs[q-1] + rowCounts[q-1];
+    rows.resize( rowOffs[commSize-1] + rowCounts[commSize-1] );
+    for( Int kLoc=0; kLoc<numRows; ++kLoc )
+        forEachPeer( kLoc, [&]( int q ) { rows[rowOffs[q]++] = kLoc; } );
+
+    counts.resize( commSize );
+    offs.resize( commSize );
+    Int offset = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        counts[q] = int(rowCounts[q]*width);
+        offs[q] = int(offset);
+        offset += rowCounts[q]*width;
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+GemvPlan<T>::GemvPlan
+( Orientation orientation,
+  const DistMatrix<T>& A,
+  const DistMatrix<T,VC,STAR>& X,
+  const DistMatrix<T,VC,STAR>& Y )
+: orientation_(orientation), A_(&A),
+  AHeight_(A.Height()), AWidth_(A.Width()),
+  AColAlign_(A.ColAlign()), ARowAlign_(A.RowAlign()),
+  XHeight_(X.Height()), YHeight_(Y.Height()), width_(X.Width()),
+  XAlign_(X.ColAlign()), YAlign_(Y.ColAlign())
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A, X, Y );
+    const bool normal = ( orientation == NORMAL );
+    if( X.Width() != Y.Width() ||
+        (normal ? A.Width() : A.Height()) != X.Height() ||
+        (normal ? A.Height() : A.Width()) != Y.Height() )
+        LogicError
+        ("Nonconformal GemvPlan: \n",DimsString(A,"A"),"\n",
+         DimsString(X,"X"),"\n",DimsString(Y,"Y"));
+
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    const int gridHeight = g.Height();
+    const int gridWidth = g.Width();
+    const int gridSize = g.Size();
+
+    // The process in the c'th process column of the r'th process row has
+    // rank r + c*gridHeight within the VC communicator.
+    //
+    // For op(A) = A, X(i,:) is needed by the gridHeight processes that own
+    // column i of A, and Z(i,:) is summed over the gridWidth processes that
+    // own row i of A; otherwise the roles of the rows and columns swap.
+    auto forEachUser = [&]( Int i, auto func )
+    {
+        if( normal )
+        {
+            const int col = A.ColOwner(i);
+            for( int row=0; row<gridHeight; ++row )
+                func( row + col*gridHeight );
+        }
+        else
+        {
+            const int row = A.RowOwner(i);
+            for( int col=0; col<gridWidth; ++col )
+                func( row + col*gridHeight );
+        }
+    };
+    auto forEachContributor = [&]( Int i, auto func )
+    {
+        if( normal )
+        {
+            const int row = A.RowOwner(i);
+            for( int col=0; col<gridWidth; ++col )
+                func( row + col*gridHeight );
+        }
+        else
+        {
+            const int col = A.ColOwner(i);
+            for( int row=0; row<gridHeight; ++row )
+                func( row + col*gridHeight );
+        }
+    };
+    const Int inputHeight = ( normal ? A.LocalWidth() : A.LocalHeight() );
+    const Int outputHeight = ( normal ? A.LocalHeight() : A.LocalWidth() );
+    auto inputIndex = [&]( Int kLoc )
+    { return normal ? A.GlobalCol(kLoc) : A.GlobalRow(kLoc); };
+    auto outputIndex = [&]( Int kLoc )
+    { return normal ? A.GlobalRow(kLoc) : A.GlobalCol(kLoc); };
+
+    ListRows
+    ( X.LocalHeight(), gridSize, width_,
+      [&]( Int iLoc, auto func ) { forEachUser( X.GlobalRow(iLoc), func ); },
+      XExchange_.sendRows, XExchange_.sendCounts, XExchange_.sendOffs );
+    ListRows
+    ( inputHeight, gridSize, width_,
+      [&]( Int kLoc, auto func ) { func( X.RowOwner(inputIndex(kLoc)) ); },
+      XExchange_.recvRows, XExchange_.recvCounts, XExchange_.recvOffs );
+    ListRows
+    ( outputHeight, gridSize, width_,
+      [&]( Int kLoc, auto func ) { func( Y.RowOwner(outputIndex(kLoc)) ); },
+      ZExchange_.sendRows, ZExchange_.sendCounts, ZExchange_.sendOffs );
+    ListRows
+    ( Y.LocalHeight(), gridSize, width_,
+      [&]( Int iLoc, auto func )
+      { forEachContributor( Y.GlobalRow(iLoc), func ); },
+      ZExchange_.recvRows, ZExchange_.recvCounts, ZExchange_.recvOffs );
+
+    XLocal_.Resize( inputHeight, width_ );
+    ZLocal_.Resize( outputHeight, width_ );
+    const Int maxRows =
+      Max( Max(XExchange_.sendRows.size(),XExchange_.recvRows.size()),
+           Max(ZExchange_.sendRows.size(),ZExchange_.recvRows.size()) );
+    const Int bufferSize = width_*maxRows;
+    sendBuf_.resize( bufferSize );
+    recvBuf_.resize( bufferSize );
+}
+
+template<typename T>
+void GemvPlan<T>::CheckConformal
+( const DistMatrix<T,VC,STAR>& X,
+  const DistMatrix<T,VC,STAR>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( A_->Height() != AHeight_ || A_->Width() != AWidth_ ||
+        A_->ColAlign() != AColAlign_ || A_->RowAlign() != ARowAlign_ )
+        LogicError("A was resized or redistributed since the plan was made");
+    if( X.Height() != XHeight_ || X.Width() != width_ ||
+        X.ColAlign() != XAlign_ ||
+        Y.Height() != YHeight_ || Y.Width() != width_ ||
+        Y.ColAlign() != YAlign_ )
+        LogicError
+        ("X and Y do not match the plan: \n",
+         DimsString(X,"X"),"\n",DimsString(Y,"Y"));
+    AssertSameGrids( *A_, X, Y );
+}
+
+template<typename T>
+void GemvPlan<T>::Apply
+( T alpha, const DistMatrix<T,VC,STAR>& X,
+  T beta,        DistMatrix<T,VC,STAR>& Y )
+{
+    EL_DEBUG_CSE
+    AUTO_PROFILE_REGION("GemvPlan.Apply", SyncInfo<Device::CPU>{});
+    CheckConformal( X, Y );
+    const Grid& g = A_->Grid();
+    if( !g.InGrid() )
+        return;
+    const mpi::Comm& comm = g.VCComm();
+    SyncInfo<Device::CPU> syncInfo;
+
+    // Route the rows of X to the owners of the matching columns (rows) of A
+    {
+        const T* XBuf = X.LockedBuffer();
+        const Int XLDim = X.LDim();
+        const auto& rows = XExchange_.sendRows;
+        const Int numSendRows = rows.size();
+        for( Int k=0; k<numSendRows; ++k )
+            for( Int j=0; j<width_; ++j )
+                sendBuf_[k*width_+j] = XBuf[rows[k]+j*XLDim];
+    }
+    mpi::AllToAll
+    ( sendBuf_.data(),
+      XExchange_.sendCounts.data(), XExchange_.sendOffs.data(),
+      recvBuf_.data(),
+      XExchange_.recvCounts.data(), XExchange_.recvOffs.data(),
+      comm, syncInfo );
+    {
+        T* XLocBuf = XLocal_.Buffer();
+        const Int XLocLDim = XLocal_.LDim();
+        const auto& rows = XExchange_.recvRows;
+        const Int numRecvRows = rows.size();
+        for( Int k=0; k<numRecvRows; ++k )
+            for( Int j=0; j<width_; ++j )
+                XLocBuf[rows[k]+j*XLocLDim] = recvBuf_[k*width_+j];
+    }
+
+    // Z := alpha op(A_loc) X_loc
+    const Int innerDim = XLocal_.Height();
+    if( innerDim == 0 )
+        Zero( ZLocal_ );
+    else if( ZLocal_.Height() != 0 && width_ != 0 )
+    {
+        const char trans = OrientationToChar( orientation_ );
+        const Matrix<T>& ALoc = A_->LockedMatrix();
+        if( width_ == 1 )
+            blas::Gemv
+            ( trans, ALoc.Height(), ALoc.Width(),
+              alpha, ALoc.LockedBuffer(), ALoc.LDim(),
+                     XLocal_.LockedBuffer(), 1,
+              T(0),  ZLocal_.Buffer(), 1 );
+        else
+            blas::Gemm
+            ( trans, 'N', ZLocal_.Height(), width_, innerDim,
+              alpha, ALoc.LockedBuffer(), ALoc.LDim(),
+                     XLocal_.LockedBuffer(), XLocal_.LDim(),
+              T(0),  ZLocal_.Buffer(), ZLocal_.LDim() );
+    }
+
+    // Sum the partial products into the owners of Y
+    {
+        const T* ZBuf = ZLocal_.LockedBuffer();
+        const Int ZLDim = ZLocal_.LDim();
+        const auto& rows = ZExchange_.sendRows;
+        const Int numSendRows = rows.size();
+        for( Int k=0; k<numSendRows; ++k )
+            for( Int j=0; j<width_; ++j )
+                sendBuf_[k*width_+j] = ZBuf[rows[k]+j*ZLDim];
+    }
+    mpi::AllToAll
+    ( sendBuf_.data(),
+      ZExchange_.sendCounts.data(), ZExchange_.sendOffs.data(),
+      recvBuf_.data(),
+      ZExchange_.recvCounts.data(), ZExchange_.recvOffs.data(),
+      comm, syncInfo );
+    Scale( beta, Y.Matrix() );
+    {
+        T* YBuf = Y.Buffer();
+        const Int YLDim = Y.LDim();
+        const auto& rows = ZExchange_.recvRows;
+        const Int numRecvRows = rows.size();
+        for( Int k=0; k<numRecvRows; ++k )
+            for( Int j=0; j<width_; ++j )
+                YBuf[rows[k]+j*YLDim] += recvBuf_[k*width_+j];
+    }
+}
+
+#define PROTO(T) template class GemvPlan<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -136,7 +136,11 @@ void LocalGer
 {
     EL_DEBUG_CSE
     // TODO(poulson): Add error checking here
-    Ger( alpha, x.LockedMatrix(), y.LockedMatrix(), A.Matrix() );
+    Ger
+    ( alpha,
+      static_cast<const Matrix<T>&>( x.LockedMatrix() ),
+      static_cast<const Matrix<T>&>( y.LockedMatrix() ),
+      static_cast<Matrix<T>&>( A.Matrix() ) );
 }
 
 #define PROTO(T) \
@@ -89,6 +89,9 @@ GetSyncInfoPool(El::Grid const& g)
 }// namespace <anon>
 #endif // HYDROGEN_HAVE_MS_GEMM
 
+#include "./Gemm/CostModel.hpp"
+#include "./Gemm/Cannon.hpp"
+#include "./Gemm/Gemm3D.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
@@ -97,6 +100,163 @@ GetSyncInfoPool(El::Grid const& g)
 namespace El
 {
 
+namespace
+{
+
+bool gemmPipelining_ = false;
+
+int gemm3DReplication_ = 0;
+
+template <Device D>
+GemmCostModel MeasureGemmCostModel(Grid const& g)
+{
+    EL_DEBUG_CSE
+    mpi::Comm const& comm = g.ViewingComm();
+    const int commSize = mpi::Size(comm);
+    const Int numReps = 5;
+    GemmCostModel model;
+
+    // gamma: the best of several local products of a modest size
+    const Int gemmSize = 128;
+    Matrix<float,D> A(gemmSize,gemmSize), B(gemmSize,gemmSize),
+        C(gemmSize,gemmSize);
+    Fill(A, float(1));
+    Fill(B, float(1));
+    auto syncInfo = SyncInfoFromMatrix(C);
+    double gemmTime = std::numeric_limits<double>::max();
+    for (Int rep=0; rep<numReps; ++rep)
+    {
+        Synchronize(syncInfo);
+        const double startTime = mpi::Time();
+        Gemm(NORMAL, NORMAL, float(1), A, B, float(0), C);
+        Synchronize(syncInfo);
+        gemmTime = Min(gemmTime, mpi::Time()-startTime);
+    }
+    model.flopTime = gemmTime / (2.*gemmSize*gemmSize*gemmSize);
+
+    if (commSize > 1)
+    {
+        const double numStages = std::ceil(std::log2(double(commSize)));
+
+        // alpha: the best of several single-entry all-reduces
+        const Int bandwidthSize = 1 << 17;
+        Matrix<float,D> buffer(bandwidthSize, 1);
+        Fill(buffer, float(1));
+        double latencyTime = std::numeric_limits<double>::max();
+        for (Int rep=0; rep<numReps; ++rep)
+        {
+            mpi::Barrier(comm);
+            const double startTime = mpi::Time();
+            mpi::AllReduce(buffer.Buffer(), 1, mpi::SUM, comm, syncInfo);
+            Synchronize(syncInfo);
+            latencyTime = Min(latencyTime, mpi::Time()-startTime);
+        }
+        model.latency = latencyTime / numStages;
+
+        // beta: a large all-reduce costs a reduce-scatter plus an all-gather
+        double bandwidthTime = std::numeric_limits<double>::max();
+        for (Int rep=0; rep<numReps; ++rep)
+        {
+            mpi::Barrier(comm);
+            const double startTime = mpi::Time();
+            mpi::AllReduce
+            (buffer.Buffer(), bandwidthSize, mpi::SUM, comm, syncInfo);
+            Synchronize(syncInfo);
+            bandwidthTime = Min(bandwidthTime, mpi::Time()-startTime);
+        }
+        const double numBytes =
+          2.*bandwidthSize*sizeof(float)*(commSize-1.)/commSize;
+        model.inverseBandwidth =
+          Max(bandwidthTime-2*numStages*model.latency, 0.) / numBytes;
+    }
+
+    // Every process must select the same algorithm, so agree on the most
+    // pessimistic measurements
+    double params[3] =
+      { model.latency, model.inverseBandwidth, model.flopTime };
+    mpi::AllReduce(params, 3, mpi::MAX, comm, SyncInfo<Device::CPU>{});
+    model.latency = params[0];
+    model.inverseBandwidth = params[1];
+    model.flopTime = params[2];
+    return model;
+}
+
+} // namespace <anon>
+
+const GemmCostModel&
+CalibrateGemmCostModel(const Grid& grid, Device D)
+{
+    EL_DEBUG_CSE
+    auto& model = grid.CachedGemmCostModel(D);
+    if (!model)
+    {
+        switch (D)
+        {
+        case Device::CPU:
+            model = std::make_shared<const GemmCostModel>(
+                MeasureGemmCostModel<Device::CPU>(grid));
+            break;
+#ifdef HYDROGEN_HAVE_GPU
+        case Device::GPU:
+            model = std::make_shared<const GemmCostModel>(
+                MeasureGemmCostModel<Device::GPU>(grid));
+            break;
+#endif // HYDROGEN_HAVE_GPU
+        default:
+            LogicError("CalibrateGemmCostModel: Bad device.");
+        }
+    }
+    return *model;
+}
+
+void SetGemmCostModel
+(const Grid& grid, const GemmCostModel& model, Device D)
+{ grid.CachedGemmCostModel(D) = std::make_shared<const GemmCostModel>(model); }
+
+void ClearGemmCostModels(const Grid& grid)
+{
+    grid.CachedGemmCostModel(Device::CPU).reset();
+#ifdef HYDROGEN_HAVE_GPU
+    grid.CachedGemmCostModel(Device::GPU).reset();
+#endif // HYDROGEN_HAVE_GPU
+}
+
+void SetGemmPipelining(bool pipeline)
+{ gemmPipelining_ = pipeline; }
+
+bool GemmPipelining()
+{ return gemmPipelining_; }
+
+void SetGemm3DReplication(int numLayers)
+{
+    if (numLayers < 0)
+        LogicError("The GEMM_3D replication factor must be non-negative");
+    gemm3DReplication_ = numLayers;
+}
+
+int Gemm3DReplication()
+{ return gemm3DReplication_; }
+
+template <typename T>
+double GemmCost
+(GemmAlgorithm alg, Orientation orientA, Orientation orientB,
+ const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+ const AbstractDistMatrix<T>& C, const GemmCostModel& model)
+{
+    EL_DEBUG_CSE
+    return gemm::Cost(alg, orientA, orientB, A, B, C, model);
+}
+
+template <typename T>
+GemmAlgorithm DefaultGemmAlgorithm
+(Orientation orientA, Orientation orientB,
+ const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+ const AbstractDistMatrix<T>& C)
+{
+    EL_DEBUG_CSE
+    return gemm::SelectAlgorithm(orientA, orientB, A, B, C);
+}
+
 template <typename T>
 void Gemm(Orientation orientA, Orientation orientB,
           T alpha, AbstractMatrix<T> const& A, AbstractMatrix<T> const& B,
@@ -282,10 +442,7 @@ void Gemm
     Scale(beta, C);
     if(orientA == NORMAL && orientB == NORMAL)
     {
-        if(alg == GEMM_CANNON)
-            gemm::Cannon_NN(alpha, A, B, C);
-        else
-            gemm::SUMMA_NN(alpha, A, B, C, alg);
+        gemm::SUMMA_NN(alpha, A, B, C, alg);
     }
     else if(orientA == NORMAL)
     {
@@ -463,6 +620,14 @@ template void Gemm(Orientation orientA, Orientation orientB,
 #endif // HYDROGEN_HAVE_GPU
 
 #define ABSTRACT_PROTO(T)                                               \
+    template double GemmCost(                                           \
+        GemmAlgorithm, Orientation, Orientation,                        \
+        AbstractDistMatrix<T> const&, AbstractDistMatrix<T> const&,     \
+        AbstractDistMatrix<T> const&, GemmCostModel const&);            \
+    template GemmAlgorithm DefaultGemmAlgorithm(                        \
+        Orientation, Orientation,                                       \
+        AbstractDistMatrix<T> const&, AbstractDistMatrix<T> const&,     \
+        AbstractDistMatrix<T> const&);                                  \
     template void Gemm(                                                 \
         Orientation, Orientation, T,                                    \
         AbstractMatrix<T> const&, AbstractMatrix<T> const&,             \
@@ -0,0 +1,285 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_CANNON_HPP
+#define EL_GEMM_CANNON_HPP
+
+namespace El {
+namespace gemm {
+namespace cannon {
+
+// Copy the columns of A into a contiguous package, grouped by the residue of
+// their local index modulo numGroups
+template<typename T>
+void PackColumnResidues(const Matrix<T>& A, Int numGroups, T* package)
+{
+    const Int height = A.Height();
+    const Int width = A.Width();
+    Int offset = 0;
+    for(Int rho=0; rho<numGroups; ++rho)
+        for(Int jLoc=rho; jLoc<width; jLoc+=numGroups, ++offset)
+            MemCopy(&package[offset*height], A.LockedBuffer(0,jLoc), height);
+}
+
+// Copy the rows of B into a contiguous (column-major) package, grouped by the
+// residue of their local index modulo numGroups
+template<typename T>
+void PackRowResidues(const Matrix<T>& B, Int numGroups, T* package)
+{
+    const Int height = B.Height();
+    const Int width = B.Width();
+    for(Int jLoc=0; jLoc<width; ++jLoc)
+    {
+        const T* BCol = B.LockedBuffer(0,jLoc);
+        T* packageCol = &package[jLoc*height];
+        Int offset = 0;
+        for(Int rho=0; rho<numGroups; ++rho)
+            for(Int iLoc=rho; iLoc<height; iLoc+=numGroups, ++offset)
+                packageCol[offset] = BCol[iLoc];
+    }
+}
+
+// The offset of residue class rho within a package of n indices grouped by
+// their residues modulo numGroups
+inline Int ResidueOffset(Int n, Int rho, Int numGroups)
+{
+    Int offset = 0;
+    for(Int sigma=0; sigma<rho; ++sigma)
+        offset += Length(n, sigma, numGroups);
+    return offset;
+}
+
+// C[MC,MR] += alpha op(A) op(B), where op(A) and op(B) are stored in
+// distributions whose local data are (after transposition) aligned with C.
+//
+// The summation index is split into L=lcm(r,c) residue classes. At step s,
+// process (i,j) multiplies the class t=(i+j+s) mod L, whose columns of op(A)
+// are owned by a single process in its grid row and whose rows of op(B) are
+// owned by a single process in its grid column. The local parts of op(A)
+// therefore circulate L/c times around each grid row and those of op(B) L/r
+// times around each grid column; on a square grid this is Cannon's original
+// algorithm. The shift for step s+1 is posted with nonblocking sends before
+// the local Gemm of step s.
+template<typename T>
+void Cannon_impl
+(Orientation orientA, Orientation orientB,
+ T alpha,
+ const ElementalMatrix<T>& A,
+ const ElementalMatrix<T>& B,
+       DistMatrix<T,MC,MR>& C)
+{
+    EL_DEBUG_CSE
+    const Grid& g = C.Grid();
+    if (!C.Participating())
+        return;
+
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int L = g.LCM();
+    const Int groupsA = L / c;
+    const Int groupsB = L / r;
+    const Int row = C.ColRank();
+    const Int col = C.RowRank();
+    mpi::Comm const& rowComm = C.RowComm();
+    mpi::Comm const& colComm = C.ColComm();
+
+    const Int sumDim = (orientA == NORMAL ? A.Width() : A.Height());
+    const Int alignA = (orientA == NORMAL ? A.RowAlign() : A.ColAlign());
+    const Int alignB = (orientB == NORMAL ? B.ColAlign() : B.RowAlign());
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+
+    // Form the local parts of op(A) and op(B)
+    const auto& ALoc = static_cast<const Matrix<T>&>(A.LockedMatrix());
+    const auto& BLoc = static_cast<const Matrix<T>&>(B.LockedMatrix());
+    Matrix<T> AOpLoc, BOpLoc;
+    if (orientA == NORMAL)
+        LockedView(AOpLoc, ALoc);
+    else
+        Transpose(ALoc, AOpLoc, orientA == ADJOINT);
+    if (orientB == NORMAL)
+        LockedView(BOpLoc, BLoc);
+    else
+        Transpose(BLoc, BOpLoc, orientB == ADJOINT);
+
+    // Double-buffered packages of op(A) and op(B)
+    const Int maxPkgSizeA = localHeight*MaxLength(sumDim,c);
+    const Int maxPkgSizeB = MaxLength(sumDim,r)*localWidth;
+    simple_buffer<T,Device::CPU> buffer(2*(maxPkgSizeA+maxPkgSizeB));
+    T* pkgA[2] = { buffer.data(), buffer.data()+maxPkgSizeA };
+    T* pkgB[2] = { buffer.data()+2*maxPkgSizeA,
+                   buffer.data()+2*maxPkgSizeA+maxPkgSizeB };
+
+    // The sizes of the packages that hold the class t
+    auto pkgWidthA = [&](Int t) { return Length(sumDim, Mod(t,c), c); };
+    auto pkgHeightB = [&](Int t) { return Length(sumDim, Mod(t,r), r); };
+
+    // Skew so that process (i,j) holds the column/row classes congruent to
+    // i+j modulo c/r. We own the classes congruent to (j-alignA) mod c and
+    // (i-alignB) mod r.
+    const Int t0 = Mod(row+col,L);
+    if (c > 1)
+    {
+        PackColumnResidues(AOpLoc, groupsA, pkgA[1]);
+        const Int sendCol = Mod(col-row-alignA,c);
+        const Int recvCol = Mod(col+row+alignA,c);
+        mpi::SendRecv(
+            pkgA[1], localHeight*AOpLoc.Width(), sendCol,
+            pkgA[0], localHeight*pkgWidthA(t0), recvCol, rowComm,
+            SyncInfo<Device::CPU>{});
+    }
+    else
+        PackColumnResidues(AOpLoc, groupsA, pkgA[0]);
+    if (r > 1)
+    {
+        PackRowResidues(BOpLoc, groupsB, pkgB[1]);
+        const Int sendRow = Mod(row-col-alignB,r);
+        const Int recvRow = Mod(row+col+alignB,r);
+        mpi::SendRecv(
+            pkgB[1], BOpLoc.Height()*localWidth, sendRow,
+            pkgB[0], pkgHeightB(t0)*localWidth, recvRow, colComm,
+            SyncInfo<Device::CPU>{});
+    }
+    else
+        PackRowResidues(BOpLoc, groupsB, pkgB[0]);
+
+    const Int leftCol = Mod(col-1,c);
+    const Int rightCol = Mod(col+1,c);
+    const Int aboveRow = Mod(row-1,r);
+    const Int belowRow = Mod(row+1,r);
+    int curA = 0, curB = 0;
+    mpi::Request<T> requests[4];
+    for(Int s=0; s<L; ++s)
+    {
+        const Int t = Mod(row+col+s,L);
+        const Int widthA = pkgWidthA(t);
+        const Int heightB = pkgHeightB(t);
+
+        // Start shifting in the packages for the next step
+        const bool shiftA = (c > 1 && s != L-1);
+        const bool shiftB = (r > 1 && s != L-1);
+        if (shiftA)
+        {
+            mpi::IRecv(
+                pkgA[1-curA], localHeight*pkgWidthA(t+1), rightCol, rowComm,
+                requests[0]);
+            mpi::ISend(
+                pkgA[curA], localHeight*widthA, leftCol, rowComm, requests[1]);
+        }
+        if (shiftB)
+        {
+            mpi::IRecv(
+                pkgB[1-curB], pkgHeightB(t+1)*localWidth, belowRow, colComm,
+                requests[2]);
+            mpi::ISend(
+                pkgB[curB], heightB*localWidth, aboveRow, colComm, requests[3]);
+        }
+
+        // C[MC,MR] += alpha op(A)(:,t) op(B)(t,:)
+        const Int rhoA = t / c;
+        const Int rhoB = t / r;
+        const Int offsetA = ResidueOffset(widthA, rhoA, groupsA);
+        const Int offsetB = ResidueOffset(heightB, rhoB, groupsB);
+        const Int classSize = Length(sumDim, t, L);
+        Matrix<T> A1, B1;
+        A1.LockedAttach(
+            localHeight, classSize, &pkgA[curA][offsetA*localHeight],
+            Max(localHeight,1));
+        B1.LockedAttach(
+            classSize, localWidth, &pkgB[curB][offsetB], Max(heightB,1));
+        Gemm(NORMAL, NORMAL, alpha, A1, B1, TypeTraits<T>::One(), C.Matrix());
+
+        if (shiftA)
+        {
+            mpi::WaitAll(2, &requests[0]);
+            curA = 1-curA;
+        }
+        if (shiftB)
+        {
+            mpi::WaitAll(2, &requests[2]);
+            curB = 1-curB;
+        }
+    }
+}
+
+} // namespace cannon
+
+// Cannon's algorithm, generalized to arbitrary dimensions and rectangular
+// process grids
+template<typename T>
+void Cannon
+(Orientation orientA, Orientation orientB,
+ T alpha,
+ const AbstractDistMatrix<T>& APre,
+ const AbstractDistMatrix<T>& BPre,
+       AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    AUTO_PROFILE_REGION("Cannon", SyncInfo<Device::CPU>{});
+
+    if (CPre.GetLocalDevice() != Device::CPU)
+        LogicError("Cannon not implemented for device!");
+
+    // Force op(A) and op(B) into [MC,MR] distributions aligned with C, which
+    // means storing transposed operands as [MR,MC]
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrlA, ctrlB;
+    if (orientA == NORMAL)
+    {
+        ctrlA.colConstrain = true;
+        ctrlA.colAlign = C.ColAlign();
+    }
+    else
+    {
+        ctrlA.rowConstrain = true;
+        ctrlA.rowAlign = C.ColAlign();
+    }
+    if (orientB == NORMAL)
+    {
+        ctrlB.rowConstrain = true;
+        ctrlB.rowAlign = C.RowAlign();
+    }
+    else
+    {
+        ctrlB.colConstrain = true;
+        ctrlB.colAlign = C.RowAlign();
+    }
+
+    auto withB = [&](const ElementalMatrix<T>& A)
+    {
+        if (orientB == NORMAL)
+        {
+            DistMatrixReadProxy<T,T,MC,MR> BProx(BPre, ctrlB);
+            cannon::Cannon_impl
+            (orientA, orientB, alpha, A, BProx.GetLocked(), C);
+        }
+        else
+        {
+            DistMatrixReadProxy<T,T,MR,MC> BProx(BPre, ctrlB);
+            cannon::Cannon_impl
+            (orientA, orientB, alpha, A, BProx.GetLocked(), C);
+        }
+    };
+    if (orientA == NORMAL)
+    {
+        DistMatrixReadProxy<T,T,MC,MR> AProx(APre, ctrlA);
+        withB(AProx.GetLocked());
+    }
+    else
+    {
+        DistMatrixReadProxy<T,T,MR,MC> AProx(APre, ctrlA);
+        withB(AProx.GetLocked());
+    }
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_CANNON_HPP
@@ -0,0 +1,294 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_COSTMODEL_HPP
+#define EL_GEMM_COSTMODEL_HPP
+
+#include <cmath>
+#include <limits>
+
+namespace El {
+namespace gemm {
+namespace cost {
+
+// The cost of a (bandwidth-optimal) all-gather or reduce-scatter over q
+// processes of a vector of 'words' entries in total
+inline double Collective
+(const GemmCostModel& model, double q, double words, double typeSize)
+{
+    if (q <= 1.)
+        return 0.;
+    return model.latency*std::ceil(std::log2(q))
+         + model.inverseBandwidth*typeSize*words*(q-1.)/q;
+}
+
+// The cost of a personalized all-to-all over q processes that redistributes
+// a vector of 'words' entries in total
+inline double AllToAll
+(const GemmCostModel& model, double q, double words, double typeSize)
+{
+    if (q <= 1.)
+        return 0.;
+    return model.latency*(q-1.)
+         + model.inverseBandwidth*typeSize*(words/q)*(q-1.)/q;
+}
+
+// The cost of redistributing a matrix into the given distribution
+template<typename T>
+double Redistribute
+(const GemmCostModel& model, const AbstractDistMatrix<T>& A,
+ Dist colDist, Dist rowDist)
+{
+    if (A.ColDist() == colDist && A.RowDist() == rowDist)
+        return 0.;
+    return AllToAll
+      (model, A.Grid().Size(), double(A.Height())*A.Width(), sizeof(T));
+}
+
+} // namespace cost
+
+// The default blocksize of the dot-product based algorithms
+constexpr Int DefaultBlockSizeDot() { return 2000; }
+
+// The number of layers that GEMM_3D replicates the grid over
+inline int ReplicationFactor(const Grid& g)
+{
+    if (Gemm3DReplication() > 0)
+        return Gemm3DReplication();
+    const int p = g.Size();
+    int numLayers = 1;
+    for (int c=2; c*c*c<=p; ++c)
+        if (p % c == 0)
+            numLayers = c;
+    return numLayers;
+}
+
+template<typename T>
+double Cost
+(GemmAlgorithm alg, Orientation orientA, Orientation orientB,
+ const AbstractDistMatrix<T>& A,
+ const AbstractDistMatrix<T>& B,
+ const AbstractDistMatrix<T>& C,
+ const GemmCostModel& model)
+{
+    EL_DEBUG_CSE
+    const Grid& g = C.Grid();
+    const double r = g.Height();
+    const double c = g.Width();
+    const double p = g.Size();
+    const double typeSize = sizeof(T);
+    const double flopsPerFma = (IsComplex<T>::value ? 8. : 2.);
+
+    const Int mInt = C.Height();
+    const Int nInt = C.Width();
+    const Int kInt = (orientA == NORMAL ? A.Width() : A.Height());
+    const double m = mInt;
+    const double n = nInt;
+    const double k = kInt;
+    const Int bsize = Blocksize();
+
+    // Bring every operand into an [MC,MR] distribution (C is read and written)
+    const double elementalRedist =
+        cost::Redistribute(model, A, MC, MR)
+      + cost::Redistribute(model, B, MC, MR)
+      + 2*cost::Redistribute(model, C, MC, MR);
+
+    // Every algorithm performs the same number of flops up to load imbalance
+    const double computeTime = model.flopTime*flopsPerFma*m*n*k/p;
+
+    // The pipelined SUMMA variants hide their nonblocking panel
+    // communication behind the local updates (up to the first/last panel,
+    // which we neglect), while any blocking redistribution of the panels is
+    // always charged in full
+    const bool pipelined =
+        GemmPipelining() && orientA == NORMAL && orientB == NORMAL &&
+        C.GetLocalDevice() == Device::CPU;
+    auto summaTime = [&](double blockingTime, double overlappedTime)
+    {
+        return blockingTime + (pipelined ?
+            Max(overlappedTime, computeTime) : overlappedTime + computeTime);
+    };
+
+    switch (alg)
+    {
+    case GEMM_SUMMA_A_MS:
+    case GEMM_SUMMA_A:
+    {
+        // For each panel of C's columns: B1[MC,MR] -> B1[VR,* ] -> B1[* ,MR]
+        // (blocking) and a reduce-scatter of D1[MC,* ] over the grid rows
+        double redistTime = 0., reduceTime = 0.;
+        for (Int j=0; j<nInt; j+=bsize)
+        {
+            const double nb = Min(bsize,nInt-j);
+            redistTime += cost::AllToAll(model, r, k*nb/c, typeSize)
+                        + cost::Collective(model, r, k*nb/c, typeSize);
+            reduceTime += cost::Collective(model, c, m*nb/r, typeSize);
+        }
+        return elementalRedist + summaTime(redistTime, reduceTime);
+    }
+    case GEMM_SUMMA_B_MS:
+    case GEMM_SUMMA_B:
+    {
+        // For each panel of C's rows: A1[MC,MR] -> A1[* ,MC] (blocking) and
+        // a reduce-scatter of D1^T[MR,* ] over the grid columns
+        double redistTime = 0., reduceTime = 0.;
+        for (Int i=0; i<mInt; i+=bsize)
+        {
+            const double nb = Min(bsize,mInt-i);
+            redistTime += cost::AllToAll(model, c, k*nb/r, typeSize)
+                        + cost::Collective(model, c, k*nb/r, typeSize);
+            reduceTime += cost::Collective(model, r, n*nb/c, typeSize);
+        }
+        return elementalRedist + summaTime(redistTime, reduceTime);
+    }
+    case GEMM_SUMMA_C_MS:
+    case GEMM_SUMMA_C:
+    {
+        // For each panel of the summation dimension: A1[MC,MR] -> A1[MC,* ]
+        // and B1[MC,MR] -> B1^T[MR,* ]
+        double commTime = 0.;
+        for (Int l=0; l<kInt; l+=bsize)
+        {
+            const double nb = Min(bsize,kInt-l);
+            commTime += cost::Collective(model, c, m*nb/r, typeSize)
+                      + cost::Collective(model, r, n*nb/c, typeSize);
+        }
+        return elementalRedist + summaTime(0., commTime);
+    }
+    case GEMM_SUMMA_DOT:
+    {
+        // One-time redistribution of A into [* ,VC] and B into [VC,* ],
+        // followed by a reduce-scatter over the full grid per block of C
+        const Int blockSizeDot = DefaultBlockSizeDot();
+        const Dist colDistA = (orientA == NORMAL ? STAR : VC);
+        const Dist rowDistA = (orientA == NORMAL ? VC : STAR);
+        const Dist colDistB = (orientB == NORMAL ? VC : STAR);
+        const Dist rowDistB = (orientB == NORMAL ? STAR : VC);
+        double commTime =
+            cost::Redistribute(model, A, colDistA, rowDistA)
+          + cost::Redistribute(model, B, colDistB, rowDistB)
+          + 2*cost::Redistribute(model, C, MC, MR);
+        for (Int i=0; i<mInt; i+=blockSizeDot)
+        {
+            const double mb = Min(blockSizeDot,mInt-i);
+            for (Int j=0; j<nInt; j+=blockSizeDot)
+            {
+                const double nb = Min(blockSizeDot,nInt-j);
+                commTime += cost::Collective(model, p, mb*nb, typeSize);
+            }
+        }
+        return commTime + computeTime;
+    }
+    case GEMM_CANNON:
+    {
+        if (C.GetLocalDevice() != Device::CPU)
+            return std::numeric_limits<double>::infinity();
+        // Transposed operands are stored as [MR,MC]
+        const double cannonRedist =
+            cost::Redistribute
+            (model, A, orientA == NORMAL ? MC : MR, orientA == NORMAL ? MR : MC)
+          + cost::Redistribute
+            (model, B, orientB == NORMAL ? MC : MR, orientB == NORMAL ? MR : MC)
+          + 2*cost::Redistribute(model, C, MC, MR);
+        // An initial skew plus lcm(r,c)-1 circular shifts of the local
+        // packages of op(A) and op(B). The shifts are always nonblocking, but
+        // (as for SUMMA) the overlap is only credited when pipelining has
+        // been requested.
+        const double numSteps = g.LCM();
+        const double shiftTime =
+            2*model.latency + model.inverseBandwidth*typeSize*(m*k+k*n)/p;
+        const double commTime = numSteps*shiftTime;
+        return cannonRedist + (GemmPipelining() ?
+            shiftTime + Max(commTime-shiftTime, computeTime) :
+            commTime + computeTime);
+    }
+    case GEMM_3D:
+    {
+        const int numLayers = ReplicationFactor(g);
+        if (C.GetLocalDevice() != Device::CPU || g.Size() % numLayers != 0)
+            return std::numeric_limits<double>::infinity();
+        // Each of the c layers is a default-height grid of p/c processes that
+        // runs SUMMA_C on a slab of k/c summation indices, so the per-process
+        // panel volume shrinks by a factor of sqrt(c). In exchange, the slabs
+        // of A and B are scattered to the layers, and the partial products are
+        // summed onto the first layer and redistributed back to C's grid.
+        const double d = numLayers;
+        const int layerSize = g.Size() / numLayers;
+        const double rLayer = Grid::DefaultHeight(layerSize);
+        const double cLayer = layerSize / rLayer;
+        const Int kLayer = (kInt+numLayers-1) / numLayers;
+        double commTime = 0.;
+        for (Int l=0; l<kLayer; l+=bsize)
+        {
+            const double nb = Min(bsize,kLayer-l);
+            commTime += cost::Collective(model, cLayer, m*nb/rLayer, typeSize)
+                      + cost::Collective(model, rLayer, n*nb/cLayer, typeSize);
+        }
+        const double replicateTime =
+            cost::AllToAll(model, p, m*k+k*n, typeSize);
+        const double reduceTime =
+            2*cost::Collective(model, d, m*n/layerSize, typeSize)
+          + cost::AllToAll(model, p, m*n, typeSize);
+        return elementalRedist + replicateTime + summaTime(0., commTime)
+             + reduceTime;
+    }
+    default:
+        return std::numeric_limits<double>::infinity();
+    }
+}
+
+template<typename T>
+GemmAlgorithm SelectAlgorithm
+(Orientation orientA, Orientation orientB,
+ const AbstractDistMatrix<T>& A,
+ const AbstractDistMatrix<T>& B,
+ const AbstractDistMatrix<T>& C)
+{
+    EL_DEBUG_CSE
+    const GemmCostModel& model =
+        CalibrateGemmCostModel(C.Grid(), C.GetLocalDevice());
+
+    // Ties are broken in favor of the earlier entries, which matches the
+    // historical preference for avoiding the communication of C
+    const GemmAlgorithm candidates[] =
+      { GEMM_SUMMA_C, GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_DOT, GEMM_CANNON,
+        GEMM_3D };
+    GemmAlgorithm bestAlg = GEMM_SUMMA_C;
+    double bestCost = std::numeric_limits<double>::infinity();
+    for (const auto& alg : candidates)
+    {
+        // Replicating the operands costs memory, so GEMM_3D must be opted
+        // into by requesting more than one layer
+        if (alg == GEMM_3D && Gemm3DReplication() <= 1)
+            continue;
+        const double algCost = Cost(alg, orientA, orientB, A, B, C, model);
+        if (algCost < bestCost)
+        {
+            bestAlg = alg;
+            bestCost = algCost;
+        }
+    }
+    return bestAlg;
+}
+
+// Switch to the multistream variant of a SUMMA algorithm
+inline GemmAlgorithm MultistreamAlgorithm(GemmAlgorithm alg)
+{
+    switch (alg)
+    {
+    case GEMM_SUMMA_A: return GEMM_SUMMA_A_MS;
+    case GEMM_SUMMA_B: return GEMM_SUMMA_B_MS;
+    case GEMM_SUMMA_C: return GEMM_SUMMA_C_MS;
+    default:           return alg;
+    }
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_COSTMODEL_HPP
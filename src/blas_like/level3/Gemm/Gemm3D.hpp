@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_GEMM3D_HPP
+#define EL_GEMM_GEMM3D_HPP
+
+namespace El {
+namespace gemm {
+
+// A 2.5D Gemm: the grid is replicated over c layers (see Grid::LayerGrid),
+// layer l forms alpha op(A)(:,K_l) op(B)(K_l,:) for the l-th slab K_l of the
+// summation index, and the partial products are summed over the depth
+// communicators. Each layer only communicates panels of size 1/sqrt(c) of
+// those of a 2D algorithm on the full grid, at the price of storing a full
+// copy of C per layer.
+template<typename T>
+void Gemm3D
+(Orientation orientA, Orientation orientB,
+ T alpha,
+ const AbstractDistMatrix<T>& APre,
+ const AbstractDistMatrix<T>& BPre,
+       AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    AUTO_PROFILE_REGION("Gemm3D", SyncInfo<Device::CPU>{});
+
+    if (CPre.GetLocalDevice() != Device::CPU)
+        LogicError("Gemm3D not implemented for device!");
+
+    const Grid& g = CPre.Grid();
+    DistMatrixReadProxy<T,T,MC,MR> AProx(APre), BProx(BPre);
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+    if (!g.InGrid())
+        return;
+
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int sumDim = (orientA == NORMAL ? A.Width() : A.Height());
+    const int numLayers = ReplicationFactor(g);
+    const int layer = g.Layer(numLayers);
+    const Grid& layerGrid = g.LayerGrid(numLayers, layer);
+
+    // Send the l-th slab of op(A) and op(B) to layer l. Every process of g
+    // takes part in each translation since any of them may own a piece of
+    // the slab.
+    DistMatrix<T,MC,MR> ALayer(layerGrid), BLayer(layerGrid);
+    for (int l=0; l<numLayers; ++l)
+    {
+        const Range<Int> K(l*sumDim/numLayers, (l+1)*sumDim/numLayers);
+        auto A1 = (orientA == NORMAL ? A(ALL,K) : A(K,ALL));
+        auto B1 = (orientB == NORMAL ? B(K,ALL) : B(ALL,K));
+        if (l == layer)
+        {
+            ALayer = A1;
+            BLayer = B1;
+        }
+        else
+        {
+            DistMatrix<T,MC,MR> AOther(g.LayerGrid(numLayers, l)),
+                                BOther(g.LayerGrid(numLayers, l));
+            AOther = A1;
+            BOther = B1;
+        }
+    }
+
+    // CLayer := alpha op(A)(:,K_l) op(B)(K_l,:)
+    DistMatrix<T,MC,MR> CLayer(layerGrid);
+    Zeros(CLayer, m, n);
+    Gemm(orientA, orientB, alpha, ALayer, BLayer, TypeTraits<T>::One(), CLayer,
+         GEMM_SUMMA_C);
+    ALayer.Empty();
+    BLayer.Empty();
+
+    // Corresponding processes of each layer own the same (contiguous) local
+    // blocks, so the partial products can be summed onto the first layer
+    // directly
+    if (numLayers > 1)
+        mpi::Reduce(
+            CLayer.Buffer(), CLayer.LocalHeight()*CLayer.LocalWidth(),
+            mpi::SUM, 0, g.DepthComm(numLayers), SyncInfo<Device::CPU>{});
+
+    // C += CLayer, translating from the first layer back to C's grid
+    DistMatrix<T,MC,MR> CTop(g.LayerGrid(numLayers, 0));
+    if (layer == 0)
+        LockedView(CTop, CLayer);
+    else
+        CTop.Resize(m, n);
+    DistMatrix<T,MC,MR> CSum(g);
+    CSum.AlignWith(C);
+    CSum = CTop;
+    Axpy(TypeTraits<T>::One(), CSum, C);
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_GEMM3D_HPP
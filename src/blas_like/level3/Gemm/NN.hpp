@@ -14,95 +14,11 @@
 #include "NN_Multistream.hpp"
 #endif // HYDROGEN_HAVE_MS_GEMM
 
+#include "NN_Pipelined.hpp"
+
 namespace El {
 namespace gemm {
 
-// Cannon's algorithm
-template<typename T>
-void Cannon_NN
-(T alpha,
-  const AbstractDistMatrix<T>& APre,
-  const AbstractDistMatrix<T>& BPre,
-        AbstractDistMatrix<T>& CPre)
-{
-    EL_DEBUG_CSE
-
-    if (APre.GetLocalDevice() != Device::CPU)
-        LogicError("Cannon_NN not implemented for device!");
-
-    const Grid& g = APre.Grid();
-    if (g.Height() != g.Width())
-        LogicError("Process grid must be square for Cannon's");
-
-    // Force A, B, and C to be in [MC,MR] distributions aligned with C
-    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
-    auto& C = CProx.Get();
-
-    ElementalProxyCtrl ctrlA, ctrlB;
-    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
-    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
-
-    DistMatrixReadProxy<T,T,MC,MR> AProx(APre, ctrlA);
-    DistMatrixReadProxy<T,T,MC,MR> BProx(BPre, ctrlB);
-    auto& A = AProx.GetLocked();
-    auto& B = BProx.GetLocked();
-
-    const Int row = g.Row();
-    const Int col = g.Col();
-    const Int pSqrt = g.Height();
-    mpi::Comm const& rowComm = g.RowComm();
-    mpi::Comm const& colComm = g.ColComm();
-    if (A.Width() % pSqrt != 0)
-        LogicError("For now, width(A) must be integer multiple of sqrt(p)");
-
-    // Load the initial A and B packages (may want to transpose B...)
-    const Int localHeightA = A.LocalHeight();
-    const Int localHeightB = B.LocalHeight();
-    const Int localWidthA = A.LocalWidth();
-    const Int localWidthB = B.LocalWidth();
-    Matrix<T> pkgA(localHeightA,localWidthA,localHeightA),
-              pkgB(localHeightB,localWidthB,localHeightB);
-    for(Int jLoc=0; jLoc<localWidthA; ++jLoc)
-        MemCopy
-        (pkgA.Buffer(0,jLoc), A.LockedBuffer(0,jLoc), localHeightA);
-    for(Int jLoc=0; jLoc<localWidthB; ++jLoc)
-        MemCopy
-        (pkgB.Buffer(0,jLoc), B.LockedBuffer(0,jLoc), localHeightB);
-
-    // Perform the initial circular shifts so that our A and B packages align
-    const Int rowShiftA = A.RowShift();
-    const Int colShiftB = B.ColShift();
-    const Int leftInitA  = Mod(col-colShiftB,pSqrt);
-    const Int rightInitA = Mod(col+colShiftB,pSqrt);
-    const Int aboveInitB = Mod(row-rowShiftA,pSqrt);
-    const Int belowInitB = Mod(row+rowShiftA,pSqrt);
-    const Int pkgSizeA = localHeightA*localWidthA;
-    const Int pkgSizeB = localHeightB*localWidthB;
-    mpi::SendRecv(pkgA.Buffer(), pkgSizeA, leftInitA, rightInitA, rowComm,
-                  SyncInfo<Device::CPU>{});
-    mpi::SendRecv(pkgB.Buffer(), pkgSizeB, aboveInitB, belowInitB, colComm,
-                  SyncInfo<Device::CPU>{});
-
-    // Now begin the data flow
-    const Int aboveRow = Mod(row-1,pSqrt);
-    const Int belowRow = Mod(row+1,pSqrt);
-    const Int leftCol  = Mod(col-1,pSqrt);
-    const Int rightCol = Mod(col+1,pSqrt);
-    for(Int q=0; q<pSqrt; ++q)
-    {
-        Gemm(NORMAL, NORMAL, alpha, pkgA, pkgB, TypeTraits<T>::One(), C.Matrix());
-        if (q != pSqrt-1)
-        {
-            mpi::SendRecv(
-                pkgA.Buffer(), pkgSizeA, leftCol, rightCol, rowComm,
-                SyncInfo<Device::CPU>{});
-            mpi::SendRecv(
-                pkgB.Buffer(), pkgSizeB, aboveRow, belowRow, colComm,
-                SyncInfo<Device::CPU>{});
-        }
-    }
-}
-
 // Normal Normal Gemm that avoids communicating the matrix A
 template <Device D, typename T, typename=EnableIf<IsDeviceValidType<T,D>>>
 void SUMMA_NNA_impl
@@ -175,7 +91,10 @@ void SUMMA_NNA(
     switch (CPre.GetLocalDevice())
     {
     case Device::CPU:
-        SUMMA_NNA_impl<Device::CPU>(alpha, APre, BPre, CPre);
+        if (GemmPipelining())
+            SUMMA_NNA_pipelined(alpha, APre, BPre, CPre);
+        else
+            SUMMA_NNA_impl<Device::CPU>(alpha, APre, BPre, CPre);
         break;
 #ifdef HYDROGEN_HAVE_GPU
     case Device::GPU:
@@ -291,7 +210,10 @@ void SUMMA_NNB
     switch (CPre.GetLocalDevice())
     {
     case Device::CPU:
-        SUMMA_NNB_impl<Device::CPU>(alpha, APre, BPre, CPre);
+        if (GemmPipelining())
+            SUMMA_NNB_pipelined(alpha, APre, BPre, CPre);
+        else
+            SUMMA_NNB_impl<Device::CPU>(alpha, APre, BPre, CPre);
         break;
 #ifdef HYDROGEN_HAVE_GPU
     case Device::GPU:
@@ -406,7 +328,10 @@ void SUMMA_NNC
     switch (CPre.GetLocalDevice())
     {
     case Device::CPU:
-        SUMMA_NNC_impl<Device::CPU>(alpha, APre, BPre, CPre);
+        if (GemmPipelining())
+            SUMMA_NNC_pipelined(alpha, APre, BPre, CPre);
+        else
+            SUMMA_NNC_impl<Device::CPU>(alpha, APre, BPre, CPre);
         break;
 #ifdef HYDROGEN_HAVE_GPU
     case Device::GPU:
@@ -528,7 +453,7 @@ void SUMMA_NNDot
   const AbstractDistMatrix<T>& APre,
   const AbstractDistMatrix<T>& BPre,
         AbstractDistMatrix<T>& CPre,
-  Int blockSize=2000)
+  Int blockSize=DefaultBlockSizeDot())
 {
     EL_DEBUG_CSE
 
@@ -568,18 +493,9 @@ void SUMMA_NN(
            DimsString(C,"C"));
    )
 
-    const Int m = C.Height();
-    const Int n = C.Width();
-    const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
-
-    // Until a real profile-based heuristic is derived, we will use
-    // the historical heuristic. If multiple streams are available, we
-    // will use the multistream versions.
+    // Consult the alpha-beta-gamma cost model for the cheapest algorithm.
+    // If multiple streams are available, we will use the multistream
+    // versions.
     if (alg == GEMM_DEFAULT)
     {
 #ifdef HYDROGEN_HAVE_MS_GEMM
@@ -589,14 +505,9 @@ void SUMMA_NN(
 #else
         bool constexpr multistream = false;
 #endif
-        if (weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim)
-            alg = GEMM_SUMMA_DOT;
-        else if (m <= n && weightTowardsC*m <= sumDim)
-            alg = (multistream ? GEMM_SUMMA_B_MS : GEMM_SUMMA_B);
-        else if (n <= m && weightTowardsC*n <= sumDim)
-            alg = (multistream ? GEMM_SUMMA_A_MS : GEMM_SUMMA_A);
-        else
-            alg = (multistream ? GEMM_SUMMA_C_MS : GEMM_SUMMA_C);
+        alg = SelectAlgorithm(NORMAL, NORMAL, A, B, C);
+        if (multistream)
+            alg = MultistreamAlgorithm(alg);
     }
 
     switch(alg)
@@ -610,7 +521,11 @@ void SUMMA_NN(
     case GEMM_SUMMA_B:    SUMMA_NNB(alpha, A, B, C); break;
     case GEMM_SUMMA_C_MS: SUMMA_NNC_MS(alpha, A, B, C); break;
     case GEMM_SUMMA_C:    SUMMA_NNC(alpha, A, B, C); break;
-    case GEMM_SUMMA_DOT:  SUMMA_NNDot(alpha, A, B, C, blockSizeDot); break;
+    case GEMM_SUMMA_DOT:
+        SUMMA_NNDot(alpha, A, B, C, DefaultBlockSizeDot());
+        break;
+    case GEMM_CANNON:     Cannon(NORMAL, NORMAL, alpha, A, B, C); break;
+    case GEMM_3D:         Gemm3D(NORMAL, NORMAL, alpha, A, B, C); break;
     default:
         LogicError("Unsupported Gemm option (this shouldn't be possible)");
     }
@@ -0,0 +1,375 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_NN_PIPELINED_HPP
+#define EL_GEMM_NN_PIPELINED_HPP
+
+#include <El/blas_like/level1/Axpy/util.hpp>
+
+// Pipelined CPU variants of the SUMMA algorithms: the communication of one
+// panel is posted with nonblocking collectives into one half of a
+// double-buffered workspace while the previous (or next) panel is
+// multiplied out of the other half. Whether the transfers actually progress
+// in the background depends upon the MPI implementation (e.g., an
+// asynchronous progress thread). Only the reduce-scatters of the A and B
+// variants are nonblocking; their transposing redistributions of the
+// panels of B and A remain blocking (and are charged as such by the cost
+// model).
+
+namespace El {
+namespace gemm {
+
+// Normal Normal Gemm that avoids communicating the matrix A; the
+// reduce-scatter of each panel of C overlaps the update of the next panel
+template <typename T,
+          typename=EnableIf<IsDeviceValidType<T,Device::CPU>>>
+void SUMMA_NNA_pipelined
+(T alpha,
+ AbstractDistMatrix<T> const& APre,
+ AbstractDistMatrix<T> const& BPre,
+ AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    constexpr auto D = Device::CPU;
+    AUTO_PROFILE_REGION(
+        "SUMMA.NNA.pipelined",
+        SyncInfoFromMatrix(
+            static_cast<Matrix<T,D> const&>(CPre.LockedMatrix())));
+
+    const Int n = CPre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& C = CProx.Get();
+
+    // D1[MC,* ] is aligned with A and scattered directly into C
+    ElementalProxyCtrl ctrlA;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre, ctrlA);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    if (!C.Participating())
+        return;
+
+    // Temporary distributions
+    DistMatrix<T,VR,STAR,ELEMENT,D> B1_VR_STAR(g);
+    DistMatrix<T,STAR,MR,ELEMENT,D> B1Trans_STAR_MR(g);
+    DistMatrix<T,MC,STAR,ELEMENT,D> D1_MC_STAR(g);
+
+    B1_VR_STAR.AlignWith(A);
+    B1Trans_STAR_MR.AlignWith(A);
+    D1_MC_STAR.AlignWith(A);
+
+    // Double-buffered send and receive storage for the reduce-scatters. The
+    // buffer is zero-initialized so that the padding entries never trigger
+    // floating-point exceptions in the reduction.
+    auto syncInfoC = SyncInfoFromMatrix(C.LockedMatrix());
+    const Int localHeight = C.LocalHeight();
+    const Int rowStride = C.RowStride();
+    const Int portionSize = mpi::Pad(localHeight*MaxLength(bsize,rowStride));
+    const Int stageSize = (rowStride+1)*portionSize;
+    simple_buffer<T,D> buffer(2*stageSize, TypeTraits<T>::Zero(), syncInfoC);
+    mpi::Request<T> requests[2];
+
+    auto finishPanel = [&](Int k, int stage)
+    {
+        const Int nb = Min(bsize,n-k);
+        auto C1 = C(ALL, IR(k,k+nb));
+        T* recvBuf = buffer.data() + stage*stageSize + rowStride*portionSize;
+        mpi::Wait(requests[stage]);
+        axpy::util::InterleaveMatrixUpdate(
+            TypeTraits<T>::One(), localHeight, C1.LocalWidth(),
+            recvBuf,     1, localHeight,
+            C1.Buffer(), 1, C1.LDim(), syncInfoC);
+    };
+
+    int stage = 0;
+    for(Int k=0; k<n; k+=bsize, stage=1-stage)
+    {
+        const Int nb = Min(bsize,n-k);
+        auto B1 = B(ALL, IR(k,k+nb));
+        auto C1 = C(ALL, IR(k,k+nb));
+
+        // D1[MC,*] := alpha A[MC,MR] B1[MR,*]
+        B1_VR_STAR = B1;
+        Transpose(B1_VR_STAR, B1Trans_STAR_MR);
+        LocalGemm(NORMAL, TRANSPOSE, alpha, A, B1Trans_STAR_MR, D1_MC_STAR);
+
+        // Post the sum of D1[MC,*] over the grid rows, scattered into the
+        // distribution of C1[MC,MR]
+        T* sendBuf = buffer.data() + stage*stageSize;
+        T* recvBuf = sendBuf + rowStride*portionSize;
+        copy::util::RowStridedPack(
+            localHeight, nb, C1.RowAlign(), rowStride,
+            D1_MC_STAR.LockedBuffer(), D1_MC_STAR.LDim(),
+            sendBuf, portionSize, syncInfoC);
+        mpi::IReduceScatter(
+            sendBuf, recvBuf, portionSize, C.RowComm(), requests[stage]);
+
+        // Complete the previous panel now that this one is in flight
+        if (k > 0)
+            finishPanel(k-bsize, 1-stage);
+    }
+    if (n > 0)
+        finishPanel(((n-1)/bsize)*bsize, 1-stage);
+}
+
+// Normal Normal Gemm that avoids communicating the matrix B; the
+// reduce-scatter of each panel of C overlaps the update of the next panel
+template <typename T,
+          typename=EnableIf<IsDeviceValidType<T,Device::CPU>>>
+void SUMMA_NNB_pipelined
+(T alpha,
+ AbstractDistMatrix<T> const& APre,
+ AbstractDistMatrix<T> const& BPre,
+ AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    constexpr auto D = Device::CPU;
+    AUTO_PROFILE_REGION(
+        "SUMMA.NNB.pipelined",
+        SyncInfoFromMatrix(
+            static_cast<Matrix<T,D> const&>(CPre.LockedMatrix())));
+
+    const Int m = CPre.Height();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& C = CProx.Get();
+
+    // D1^T[MR,* ] is aligned with B and scattered directly into C
+    ElementalProxyCtrl ctrlB;
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre, ctrlB);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    if (!C.Participating())
+        return;
+
+    // Temporary distributions
+    DistMatrix<T,STAR,MC,ELEMENT,D> A1_STAR_MC(g);
+    DistMatrix<T,MR,STAR,ELEMENT,D> D1Trans_MR_STAR(g);
+    Matrix<T,D> D1Local;
+
+    A1_STAR_MC.AlignWith(B);
+    D1Trans_MR_STAR.AlignWith(B);
+
+    // Double-buffered send and receive storage for the reduce-scatters
+    auto syncInfoC = SyncInfoFromMatrix(C.LockedMatrix());
+    const Int localWidth = C.LocalWidth();
+    const Int colStride = C.ColStride();
+    const Int portionSize = mpi::Pad(MaxLength(bsize,colStride)*localWidth);
+    const Int stageSize = (colStride+1)*portionSize;
+    simple_buffer<T,D> buffer(2*stageSize, TypeTraits<T>::Zero(), syncInfoC);
+    mpi::Request<T> requests[2];
+
+    auto finishPanel = [&](Int k, int stage)
+    {
+        const Int nb = Min(bsize,m-k);
+        auto C1 = C(IR(k,k+nb), ALL);
+        T* recvBuf = buffer.data() + stage*stageSize + colStride*portionSize;
+        mpi::Wait(requests[stage]);
+        axpy::util::InterleaveMatrixUpdate(
+            TypeTraits<T>::One(), C1.LocalHeight(), localWidth,
+            recvBuf,     1, C1.LocalHeight(),
+            C1.Buffer(), 1, C1.LDim(), syncInfoC);
+    };
+
+    int stage = 0;
+    for(Int k=0; k<m; k+=bsize, stage=1-stage)
+    {
+        const Int nb = Min(bsize,m-k);
+        auto A1 = A(IR(k,k+nb), ALL);
+        auto C1 = C(IR(k,k+nb), ALL);
+
+        // D1^T[MR,* ] := alpha B^T[MR,MC] A1^T[MC,* ]
+        A1_STAR_MC = A1;
+        LocalGemm(
+            TRANSPOSE, TRANSPOSE, alpha, B, A1_STAR_MC, D1Trans_MR_STAR);
+
+        // Post the sum of D1[* ,MR] over the grid columns, scattered into
+        // the distribution of C1[MC,MR]
+        T* sendBuf = buffer.data() + stage*stageSize;
+        T* recvBuf = sendBuf + colStride*portionSize;
+        Transpose(D1Trans_MR_STAR.LockedMatrix(), D1Local);
+        copy::util::ColStridedPack(
+            nb, localWidth, C1.ColAlign(), colStride,
+            D1Local.LockedBuffer(), D1Local.LDim(),
+            sendBuf, portionSize, syncInfoC);
+        mpi::IReduceScatter(
+            sendBuf, recvBuf, portionSize, C.ColComm(), requests[stage]);
+
+        // Complete the previous panel now that this one is in flight
+        if (k > 0)
+            finishPanel(k-bsize, 1-stage);
+    }
+    if (m > 0)
+        finishPanel(((m-1)/bsize)*bsize, 1-stage);
+}
+
+// Normal Normal Gemm that avoids communicating the matrix C; the
+// all-gathers of panel k+1 of A and B overlap the update with panel k
+template <typename T,
+          typename=EnableIf<IsDeviceValidType<T,Device::CPU>>>
+void SUMMA_NNC_pipelined
+(T alpha,
+ AbstractDistMatrix<T> const& APre,
+ AbstractDistMatrix<T> const& BPre,
+ AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    constexpr auto D = Device::CPU;
+    AUTO_PROFILE_REGION(
+        "SUMMA.NNC.pipelined",
+        SyncInfoFromMatrix(
+            static_cast<Matrix<T,D> const&>(CPre.LockedMatrix())));
+
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& C = CProx.Get();
+
+    // A1[MC,* ] and B1[* ,MR] are formed directly in the alignments of C
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre, ctrlA);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre, ctrlB);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    if (!C.Participating())
+        return;
+
+    auto syncInfoC = SyncInfoFromMatrix(C.LockedMatrix());
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+    const Int rowStride = A.RowStride();
+    const Int colStride = B.ColStride();
+    Matrix<T,D> A1Local(localHeight, bsize), B1Local(bsize, localWidth);
+
+    // Double-buffered send and receive storage for the all-gathers
+    const Int portionSizeA = mpi::Pad(localHeight*MaxLength(bsize,rowStride));
+    const Int portionSizeB = mpi::Pad(MaxLength(bsize,colStride)*localWidth);
+    const Int stageSizeA = (rowStride+1)*portionSizeA;
+    const Int stageSizeB = (colStride+1)*portionSizeB;
+    const Int stageSize = stageSizeA + stageSizeB;
+    simple_buffer<T,D> buffer(2*stageSize, syncInfoC);
+    mpi::Request<T> requestsA[2], requestsB[2];
+
+    auto startPanel = [&](Int k, int stage)
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        auto A1 = A(ALL,        IR(k,k+nb));
+        auto B1 = B(IR(k,k+nb), ALL       );
+
+        T* sendBufA = buffer.data() + stage*stageSize;
+        T* recvBufA = sendBufA + portionSizeA;
+        T* sendBufB = sendBufA + stageSizeA;
+        T* recvBufB = sendBufB + portionSizeB;
+
+        // A1[MC,MR] -> A1[MC,* ]
+        copy::util::InterleaveMatrix(
+            localHeight, A1.LocalWidth(),
+            A1.LockedBuffer(), 1, A1.LDim(),
+            sendBufA,          1, localHeight, syncInfoC);
+        mpi::IAllGather(
+            sendBufA, portionSizeA, recvBufA, portionSizeA, A.RowComm(),
+            requestsA[stage]);
+
+        // B1[MC,MR] -> B1[* ,MR]
+        copy::util::InterleaveMatrix(
+            B1.LocalHeight(), localWidth,
+            B1.LockedBuffer(), 1, B1.LDim(),
+            sendBufB,          1, B1.LocalHeight(), syncInfoC);
+        mpi::IAllGather(
+            sendBufB, portionSizeB, recvBufB, portionSizeB, B.ColComm(),
+            requestsB[stage]);
+    };
+
+    if (sumDim > 0)
+        startPanel(0, 0);
+
+    int stage = 0;
+    for(Int k=0; k<sumDim; k+=bsize, stage=1-stage)
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        auto A1 = A(ALL,        IR(k,k+nb));
+        auto B1 = B(IR(k,k+nb), ALL       );
+
+        // Prefetch the next panel into the other half of the workspace
+        if (k+bsize < sumDim)
+            startPanel(k+bsize, 1-stage);
+
+        const T* recvBufA = buffer.data() + stage*stageSize + portionSizeA;
+        const T* recvBufB = recvBufA + rowStride*portionSizeA + portionSizeB;
+        A1Local.Resize(localHeight, nb);
+        B1Local.Resize(nb, localWidth);
+
+        mpi::Wait(requestsA[stage]);
+        copy::util::RowStridedUnpack(
+            localHeight, nb, A1.RowAlign(), rowStride,
+            recvBufA, portionSizeA,
+            A1Local.Buffer(), A1Local.LDim(), syncInfoC);
+
+        mpi::Wait(requestsB[stage]);
+        copy::util::ColStridedUnpack(
+            nb, localWidth, B1.ColAlign(), colStride,
+            recvBufB, portionSizeB,
+            B1Local.Buffer(), B1Local.LDim(), syncInfoC);
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        Gemm(NORMAL, NORMAL,
+             alpha, A1Local, B1Local, TypeTraits<T>::One(), C.Matrix());
+    }
+}
+
+template <typename T,
+          typename=DisableIf<IsDeviceValidType<T,Device::CPU>>,
+          typename=void>
+void SUMMA_NNA_pipelined(T alpha,
+                         AbstractDistMatrix<T> const& APre,
+                         AbstractDistMatrix<T> const& BPre,
+                         AbstractDistMatrix<T>& CPre)
+{
+    LogicError("SUMMA_NNA_pipelined type-device combo not supported.");
+}
+
+template <typename T,
+          typename=DisableIf<IsDeviceValidType<T,Device::CPU>>,
+          typename=void>
+void SUMMA_NNB_pipelined(T alpha,
+                         AbstractDistMatrix<T> const& APre,
+                         AbstractDistMatrix<T> const& BPre,
+                         AbstractDistMatrix<T>& CPre)
+{
+    LogicError("SUMMA_NNB_pipelined type-device combo not supported.");
+}
+
+template <typename T,
+          typename=DisableIf<IsDeviceValidType<T,Device::CPU>>,
+          typename=void>
+void SUMMA_NNC_pipelined(T alpha,
+                         AbstractDistMatrix<T> const& APre,
+                         AbstractDistMatrix<T> const& BPre,
+                         AbstractDistMatrix<T>& CPre)
+{
+    LogicError("SUMMA_NNC_pipelined type-device combo not supported.");
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_NN_PIPELINED_HPP
@@ -376,7 +376,7 @@ void SUMMA_NTDot_impl
   const AbstractDistMatrix<T>& APre,
   const AbstractDistMatrix<T>& BPre,
         AbstractDistMatrix<T>& CPre,
-  Int blockSize=2000)
+  Int blockSize=DefaultBlockSizeDot())
 {
     EL_DEBUG_CSE;
     const Int m = CPre.Height();
@@ -424,7 +424,7 @@ void SUMMA_NTDot_impl(Orientation orientB,
                       AbstractDistMatrix<T> const& APre,
                       AbstractDistMatrix<T> const& BPre,
                       AbstractDistMatrix<T>& CPre,
-                      Int blockSize=2000)
+                      Int blockSize=DefaultBlockSizeDot())
 {
     LogicError("SUMMA_NTDot_impl type-device combo not supported.");
 }
@@ -436,7 +436,7 @@ void SUMMA_NTDot
  const AbstractDistMatrix<T>& APre,
  const AbstractDistMatrix<T>& BPre,
  AbstractDistMatrix<T>& CPre,
- Int blockSize=2000)
+ Int blockSize=DefaultBlockSizeDot())
 {
     EL_DEBUG_CSE;
 
@@ -482,15 +482,9 @@ void SUMMA_NT
     }
 #endif // H_RELEASE
 
-    const Int m = C.Height();
-    const Int n = C.Width();
-    const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
-
+    // Consult the alpha-beta-gamma cost model for the cheapest algorithm.
+    // If multiple streams are available, we will use the multistream
+    // versions.
     if (alg == GEMM_DEFAULT)
     {
 #ifdef HYDROGEN_HAVE_MS_GEMM
@@ -500,14 +494,9 @@ void SUMMA_NT
 #else
         bool constexpr multistream = false;
 #endif
-        if(weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim)
-            alg = GEMM_SUMMA_DOT;
-        else if(m <= n && weightTowardsC*m <= sumDim)
-            alg = (multistream ? GEMM_SUMMA_B_MS : GEMM_SUMMA_B);
-        else if(n <= m && weightTowardsC*n <= sumDim)
-            alg = (multistream ? GEMM_SUMMA_A_MS : GEMM_SUMMA_A);
-        else
-            alg = (multistream ? GEMM_SUMMA_C_MS : GEMM_SUMMA_C);
+        alg = SelectAlgorithm(NORMAL, orientB, A, B, C);
+        if (multistream)
+            alg = MultistreamAlgorithm(alg);
     }
     switch(alg)
     {
@@ -521,8 +510,10 @@ void SUMMA_NT
     case GEMM_SUMMA_C_MS: SUMMA_NTC_MS(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_C:    SUMMA_NTC(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_DOT:
-        SUMMA_NTDot(orientB, alpha, A, B, C, blockSizeDot);
+        SUMMA_NTDot(orientB, alpha, A, B, C, DefaultBlockSizeDot());
         break;
+    case GEMM_CANNON: Cannon(NORMAL, orientB, alpha, A, B, C); break;
+    case GEMM_3D:     Gemm3D(NORMAL, orientB, alpha, A, B, C); break;
     default:
         LogicError("Unsupported Gemm option");
     }
@@ -434,7 +434,7 @@ void SUMMA_TNDot
   const AbstractDistMatrix<T>& APre,
   const AbstractDistMatrix<T>& BPre,
   AbstractDistMatrix<T>& CPre,
-    Int blockSize=2000)
+    Int blockSize=DefaultBlockSizeDot())
 {
     EL_DEBUG_CSE
 
@@ -479,15 +479,9 @@ void SUMMA_TN
            DimsString(C,"C"));
    )
 
-    const Int m = C.Height();
-    const Int n = C.Width();
-    const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
-
+    // Consult the alpha-beta-gamma cost model for the cheapest algorithm.
+    // If multiple streams are available, we will use the multistream
+    // versions.
     if (alg == GEMM_DEFAULT)
     {
 #ifdef HYDROGEN_HAVE_MS_GEMM
@@ -497,14 +491,9 @@ void SUMMA_TN
 #else
         bool constexpr multistream = false;
 #endif // HYDROGEN_HAVE_MS_GEMM
-        if(weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim)
-            alg = GEMM_SUMMA_DOT;
-        else if(m <= n && weightTowardsC*m <= sumDim)
-            alg = (multistream ? GEMM_SUMMA_B_MS : GEMM_SUMMA_B);
-        else if(n <= m && weightTowardsC*n <= sumDim)
-            alg = (multistream ? GEMM_SUMMA_A_MS : GEMM_SUMMA_A);
-        else
-            alg = (multistream ? GEMM_SUMMA_C_MS : GEMM_SUMMA_C);
+        alg = SelectAlgorithm(orientA, NORMAL, A, B, C);
+        if (multistream)
+            alg = MultistreamAlgorithm(alg);
     }
 
     switch(alg)
@@ -519,8 +508,10 @@ void SUMMA_TN
     case GEMM_SUMMA_C_MS: SUMMA_TNC_MS(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_C:    SUMMA_TNC(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_DOT:
-        SUMMA_TNDot(orientA, alpha, A, B, C, blockSizeDot);
+        SUMMA_TNDot(orientA, alpha, A, B, C, DefaultBlockSizeDot());
         break;
+    case GEMM_CANNON: Cannon(orientA, NORMAL, alpha, A, B, C); break;
+    case GEMM_3D:     Gemm3D(orientA, NORMAL, alpha, A, B, C); break;
     default:
         LogicError("Unsupported Gemm option");
     }
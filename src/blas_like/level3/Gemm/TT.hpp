@@ -354,7 +354,7 @@ void SUMMA_TTDot
  const AbstractDistMatrix<T>& APre,
  const AbstractDistMatrix<T>& BPre,
  AbstractDistMatrix<T>& CPre,
- Int blockSize=2000)
+ Int blockSize=DefaultBlockSizeDot())
 {
     EL_DEBUG_CSE
 
@@ -399,27 +399,12 @@ void SUMMA_TT
            DimsString(B,"B"),"\n",
            DimsString(C,"C"));
    )
-    const Int m = C.Height();
-    const Int n = C.Width();
-    const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    // Consult the alpha-beta-gamma cost model for the cheapest algorithm
+    if (alg == GEMM_DEFAULT)
+        alg = SelectAlgorithm(orientA, orientB, A, B, C);
 
     switch(alg)
     {
-    case GEMM_DEFAULT:
-        if (weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim)
-            SUMMA_TTDot(orientA, orientB, alpha, A, B, C, blockSizeDot);
-        else if (m <= n && weightTowardsC*m <= sumDim)
-            SUMMA_TTB(orientA, orientB, alpha, A, B, C);
-        else if (n <= m && weightTowardsC*n <= sumDim)
-            SUMMA_TTA(orientA, orientB, alpha, A, B, C);
-        else
-            SUMMA_TTC(orientA, orientB, alpha, A, B, C);
-        break;
     case GEMM_SUMMA_A:
         SUMMA_TTA(orientA, orientB, alpha, A, B, C);
         break;
@@ -432,6 +417,12 @@ void SUMMA_TT
     case GEMM_SUMMA_DOT:
         SUMMA_TTDot(orientA, orientB, alpha, A, B, C);
         break;
+    case GEMM_CANNON:
+        Cannon(orientA, orientB, alpha, A, B, C);
+        break;
+    case GEMM_3D:
+        Gemm3D(orientA, orientB, alpha, A, B, C);
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -0,0 +1,269 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+#include "El/core/Profiling.hpp"
+
+namespace El
+{
+
+namespace
+{
+
+// Products whose dimensions are all at most these sizes are formed directly
+// rather than through blas::Gemm. Vendor BLAS libraries already take fast
+// paths for small products, so only the tiniest ones, whose columns fit in
+// registers, are worth forming directly for their types; for the other
+// types, packing dominates far larger products.
+constexpr Int smallBlasGemmDim = 4;
+constexpr Int smallGemmDim = 16;
+
+// The number of rows up to which op(A) op(B) has a kernel specialized to its
+// height
+constexpr Int smallGemmHeight = 4;
+
+// op(X)(i,j) of a column-major matrix
+template <typename T>
+T OpEntry(Orientation orient, T const* X, Int XLDim, Int i, Int j)
+{
+    switch (orient)
+    {
+    case NORMAL:
+        return X[i+j*XLDim];
+    case TRANSPOSE:
+        return X[j+i*XLDim];
+    default:
+        return Conj(X[j+i*XLDim]);
+    }
+}
+
+// The product for an op(A) with exactly M rows
+template <Int M, typename T>
+void FixedHeightGemm(
+    Orientation orientA, Orientation orientB,
+    Int n, Int k,
+    T alpha, T const* A, Int ALDim, T const* B, Int BLDim,
+    T beta, T* C, Int CLDim)
+{
+    for (Int j=0; j<n; ++j)
+    {
+        T gamma[M];
+        for (Int i=0; i<M; ++i)
+            gamma[i] = TypeTraits<T>::Zero();
+        if (orientA == NORMAL)
+        {
+            for (Int l=0; l<k; ++l)
+            {
+                const T b = OpEntry(orientB, B, BLDim, l, j);
+                T const* a = &A[l*ALDim];
+                for (Int i=0; i<M; ++i)
+                    gamma[i] += a[i]*b;
+            }
+        }
+        else
+        {
+            for (Int l=0; l<k; ++l)
+            {
+                const T b = OpEntry(orientB, B, BLDim, l, j);
+                for (Int i=0; i<M; ++i)
+                    gamma[i] += OpEntry(orientA, A, ALDim, i, l)*b;
+            }
+        }
+
+        // Follow BLAS in overwriting, rather than scaling, C when beta is
+        // zero so that NaNs in the input do not propagate
+        T* c = &C[j*CLDim];
+        if (beta == TypeTraits<T>::Zero())
+            for (Int i=0; i<M; ++i)
+                c[i] = alpha*gamma[i];
+        else
+            for (Int i=0; i<M; ++i)
+                c[i] = alpha*gamma[i] + beta*c[i];
+    }
+}
+
+template <typename T>
+void SmallGemm(
+    Orientation orientA, Orientation orientB,
+    Int m, Int n, Int k,
+    T alpha, T const* A, Int ALDim, T const* B, Int BLDim,
+    T beta, T* C, Int CLDim)
+{
+    // A column of op(A) op(B) is accumulated in a local array, which
+    // cannot alias the operands, before it is merged into C
+    T gamma[smallGemmDim];
+    for (Int j=0; j<n; ++j)
+    {
+        for (Int i=0; i<m; ++i)
+            gamma[i] = TypeTraits<T>::Zero();
+        if (orientA == NORMAL)
+        {
+            for (Int l=0; l<k; ++l)
+            {
+                const T b = OpEntry(orientB, B, BLDim, l, j);
+                T const* a = &A[l*ALDim];
+                for (Int i=0; i<m; ++i)
+                    gamma[i] += a[i]*b;
+            }
+        }
+        else
+        {
+            const bool conjugate = (orientA == ADJOINT);
+            for (Int i=0; i<m; ++i)
+            {
+                T const* a = &A[i*ALDim];
+                for (Int l=0; l<k; ++l)
+                    gamma[i] += (conjugate ? Conj(a[l]) : a[l])
+                        * OpEntry(orientB, B, BLDim, l, j);
+            }
+        }
+
+        T* c = &C[j*CLDim];
+        if (beta == TypeTraits<T>::Zero())
+            for (Int i=0; i<m; ++i)
+                c[i] = alpha*gamma[i];
+        else
+            for (Int i=0; i<m; ++i)
+                c[i] = alpha*gamma[i] + beta*c[i];
+    }
+}
+
+template <typename T>
+void BatchMemberGemm(
+    Orientation orientA, Orientation orientB,
+    Int m, Int n, Int k,
+    T alpha, T const* A, Int ALDim, T const* B, Int BLDim,
+    T beta, T* C, Int CLDim)
+{
+    const Int maxDim = Max(m, Max(n, k));
+    if (maxDim > (IsBlasScalar<T>::value ? smallBlasGemmDim : smallGemmDim))
+        blas::Gemm(OrientationToChar(orientA), OrientationToChar(orientB),
+                   m, n, k,
+                   alpha, A, ALDim, B, BLDim,
+                   beta, C, CLDim);
+    else if (m <= smallGemmHeight)
+    {
+        switch (m)
+        {
+        case 0:
+            break;
+        case 1:
+            FixedHeightGemm<1>(orientA, orientB, n, k,
+                               alpha, A, ALDim, B, BLDim, beta, C, CLDim);
+            break;
+        case 2:
+            FixedHeightGemm<2>(orientA, orientB, n, k,
+                               alpha, A, ALDim, B, BLDim, beta, C, CLDim);
+            break;
+        case 3:
+            FixedHeightGemm<3>(orientA, orientB, n, k,
+                               alpha, A, ALDim, B, BLDim, beta, C, CLDim);
+            break;
+        default:
+            FixedHeightGemm<4>(orientA, orientB, n, k,
+                               alpha, A, ALDim, B, BLDim, beta, C, CLDim);
+        }
+    }
+    else
+        SmallGemm(orientA, orientB, m, n, k,
+                  alpha, A, ALDim, B, BLDim, beta, C, CLDim);
+}
+
+}// namespace <anon>
+
+template <typename T>
+void GemmBatched(
+    Orientation orientA, Orientation orientB,
+    T alpha, vector<Matrix<T>> const& A, vector<Matrix<T>> const& B,
+    T beta, vector<Matrix<T>>& C)
+{
+    EL_DEBUG_CSE
+    AUTO_PROFILE_REGION("GemmBatched.CPU", SyncInfo<Device::CPU>{});
+
+    const Int batchCount = C.size();
+    if (Int(A.size()) != batchCount || Int(B.size()) != batchCount)
+        LogicError("GemmBatched: batches of different lengths: ",
+                   A.size(), ", ", B.size(), " and ", C.size());
+    // Check every member up front since the products are formed within a
+    // parallel loop
+    for (Int l=0; l<batchCount; ++l)
+    {
+        const Int m = (orientA == NORMAL ? A[l].Height() : A[l].Width());
+        const Int kA = (orientA == NORMAL ? A[l].Width() : A[l].Height());
+        const Int kB = (orientB == NORMAL ? B[l].Height() : B[l].Width());
+        const Int n = (orientB == NORMAL ? B[l].Width() : B[l].Height());
+        if (m != C[l].Height() || n != C[l].Width() || kA != kB)
+            LogicError("Nonconformal GemmBatched member ", l, ":\n",
+                       DimsString(A[l], "  A"), "\n",
+                       DimsString(B[l], "  B"), "\n",
+                       DimsString(C[l], "  C"));
+    }
+
+    EL_PARALLEL_FOR
+    for (Int l=0; l<batchCount; ++l)
+    {
+        const Int k = (orientA == NORMAL ? A[l].Width() : A[l].Height());
+        BatchMemberGemm(orientA, orientB, C[l].Height(), C[l].Width(), k,
+                        alpha, A[l].LockedBuffer(), A[l].LDim(),
+                        B[l].LockedBuffer(), B[l].LDim(),
+                        beta, C[l].Buffer(), C[l].LDim());
+    }
+}
+
+template <typename T>
+void GemmStridedBatched(
+    Orientation orientA, Orientation orientB,
+    Int m, Int n, Int k,
+    T alpha, T const* A, Int ALDim, Int AStride,
+    T const* B, Int BLDim, Int BStride,
+    T beta, T* C, Int CLDim, Int CStride,
+    Int batchCount)
+{
+    EL_DEBUG_CSE
+    AUTO_PROFILE_REGION("GemmStridedBatched.CPU", SyncInfo<Device::CPU>{});
+    if (m < 0 || n < 0 || k < 0 || batchCount < 0)
+        LogicError("GemmStridedBatched: negative dimensions: m=", m,
+                   ", n=", n, ", k=", k, ", batchCount=", batchCount);
+    if (ALDim < Max(orientA == NORMAL ? m : k, Int(1)) ||
+        BLDim < Max(orientB == NORMAL ? k : n, Int(1)) ||
+        CLDim < Max(m, Int(1)))
+        LogicError("GemmStridedBatched: leading dimensions ", ALDim, ", ",
+                   BLDim, " and ", CLDim, " are too small");
+
+    EL_PARALLEL_FOR
+    for (Int l=0; l<batchCount; ++l)
+        BatchMemberGemm(orientA, orientB, m, n, k,
+                        alpha, &A[l*AStride], ALDim,
+                        &B[l*BStride], BLDim,
+                        beta, &C[l*CStride], CLDim);
+}
+
+#define PROTO(T)                                        \
+    template void GemmBatched(                          \
+        Orientation orientA, Orientation orientB,       \
+        T alpha, vector<Matrix<T>> const& A,            \
+        vector<Matrix<T>> const& B,                     \
+        T beta, vector<Matrix<T>>& C);                  \
+    template void GemmStridedBatched(                   \
+        Orientation orientA, Orientation orientB,       \
+        Int m, Int n, Int k,                            \
+        T alpha, T const* A, Int ALDim, Int AStride,    \
+        T const* B, Int BLDim, Int BStride,             \
+        T beta, T* C, Int CLDim, Int CStride,           \
+        Int batchCount);
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -150,7 +150,7 @@ void RLA
         Z1Trans_MR_MC = Z1Trans;
         AxpyContract( T(1), Z1Trans_MR_STAR, Z1Trans_MR_MC );
         Transpose( Z1Trans_MR_MC.LockedMatrix(), Z1Local, conjugate );
-        C1.Matrix() += Z1Local;
+        Axpy( T(1), Z1Local, C1.Matrix() );
     }
 }
 
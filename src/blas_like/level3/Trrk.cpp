@@ -27,7 +27,10 @@ void TrrkInternal(
 {
     EL_DEBUG_CSE;
     ScaleTrapezoid(beta, uplo, C);
-    if (orientA==NORMAL && orientB==NORMAL)
+    const Int tileSize = trrk::TaskTileSize<T>(C.Height(), C.Width());
+    if (tileSize > 0)
+        trrk::TiledTrrk(uplo, orientA, orientB, alpha, A, B, C, tileSize);
+    else if (orientA==NORMAL && orientB==NORMAL)
         trrk::TrrkNN(uplo, alpha, A, B, C);
     else if (orientA==NORMAL)
         trrk::TrrkNT(uplo, orientB, alpha, A, B, C);
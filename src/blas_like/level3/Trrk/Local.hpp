@@ -488,6 +488,162 @@ void LocalTrrkKernel
     LocalAxpyTrapezoid(uplo, T(1), DBR, CBR);
 }
 
+// Returns the side length of the square tiles that a height x width local
+// update should be split into so that the tiles can be updated by concurrent
+// tasks, or zero if the update should instead be performed recursively.
+//
+// The roughly nt(nt+1)/2 tiles of the triangle are chosen to be several times
+// the number of threads, but no smaller than LocalTrrkBlocksize<T>() so that
+// each tile remains a reasonably efficient Gemm.
+template<typename T>
+Int TaskTileSize(Int height, Int width)
+{
+#ifdef EL_HYBRID
+# if defined(HYDROGEN_HAVE_OMP_TASKLOOP)
+    const Int numThreads = omp_get_num_threads();
+# else
+    // A nested parallel region would only be given a single thread
+    const Int numThreads = (omp_in_parallel() ? 1 : omp_get_max_threads());
+# endif
+    if (numThreads <= 1)
+        return 0;
+    const Int n = Max(height, width);
+    const Int tilesPerDim = Int(Ceil(Sqrt(8.*numThreads)));
+    const Int tileSize =
+      Max(LocalTrrkBlocksize<T>(), (n+tilesPerDim-1)/tilesPerDim);
+    return (tileSize < n ? tileSize : 0);
+#else
+    return 0;
+#endif
+}
+
+// Local C := alpha op(A) op(B) + C, where only the entries of the lower or
+// upper triangle of the global matrix are updated. The local entry (i,j) of C
+// is assumed to be the global entry (colShift+i*colStride,rowShift+j*rowStride).
+//
+// C is split into tileSize x tileSize tiles, and each tile that intersects the
+// triangle is updated by a separate task. Tiles that lie entirely within the
+// triangle are updated with a single Gemm, while those that are cut by the
+// diagonal are formed in a temporary and then added in. When the tiles are
+// updated by concurrent tasks, MKL is limited to a single thread within each
+// task; other BLAS libraries keep their configured thread counts.
+template<typename T>
+void TiledTrrk
+(UpperOrLower uplo,
+  Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+                 Matrix<T>& C,
+  Int tileSize,
+  Int colShift=0, Int colStride=1, Int rowShift=0, Int rowStride=1)
+{
+    EL_DEBUG_CSE
+    const Int height = C.Height();
+    const Int width = C.Width();
+    const Int numRowTiles = (height+tileSize-1)/tileSize;
+    const Int numColTiles = (width+tileSize-1)/tileSize;
+    auto globalRow = [&](Int i) { return colShift + i*colStride; };
+    auto globalCol = [&](Int j) { return rowShift + j*rowStride; };
+
+    // List the tiles that intersect the triangle
+    vector<Int> tileRows, tileCols;
+    vector<bool> tileIsCut;
+    for (Int jTile=0; jTile<numColTiles; ++jTile)
+    {
+        const Int j0 = jTile*tileSize;
+        const Int j1 = Min(j0+tileSize, width);
+        for (Int iTile=0; iTile<numRowTiles; ++iTile)
+        {
+            const Int i0 = iTile*tileSize;
+            const Int i1 = Min(i0+tileSize, height);
+            const Int rowMin = globalRow(i0), rowMax = globalRow(i1-1);
+            const Int colMin = globalCol(j0), colMax = globalCol(j1-1);
+            const bool inside =
+              (uplo == LOWER ? rowMin >= colMax : rowMax <= colMin);
+            const bool outside =
+              (uplo == LOWER ? rowMax < colMin : rowMin > colMax);
+            if (outside)
+                continue;
+            tileRows.push_back(iTile);
+            tileCols.push_back(jTile);
+            tileIsCut.push_back(!inside);
+        }
+    }
+    const Int numTiles = tileRows.size();
+
+    auto updateTile = [&](Int t)
+    {
+        const Int i0 = tileRows[t]*tileSize;
+        const Int i1 = Min(i0+tileSize, height);
+        const Int j0 = tileCols[t]*tileSize;
+        const Int j1 = Min(j0+tileSize, width);
+        const auto indRow = IR(i0,i1);
+        const auto indCol = IR(j0,j1);
+
+        Matrix<T> A1, B1;
+        if (orientationOfA == NORMAL)
+            LockedView(A1, A, indRow, IR(0,A.Width()));
+        else
+            LockedView(A1, A, IR(0,A.Height()), indRow);
+        if (orientationOfB == NORMAL)
+            LockedView(B1, B, IR(0,B.Height()), indCol);
+        else
+            LockedView(B1, B, indCol, IR(0,B.Width()));
+        auto C11 = C(indRow,indCol);
+
+        if (!tileIsCut[t])
+        {
+            Gemm(orientationOfA, orientationOfB, alpha, A1, B1, T(1), C11);
+            return;
+        }
+
+        Matrix<T> D11;
+        Gemm(orientationOfA, orientationOfB, alpha, A1, B1, D11);
+        const T* DBuf = D11.LockedBuffer();
+        const Int DLDim = D11.LDim();
+        T* CBuf = C11.Buffer();
+        const Int CLDim = C11.LDim();
+        for (Int j=0; j<j1-j0; ++j)
+        {
+            const Int jGlob = globalCol(j0+j);
+            for (Int i=0; i<i1-i0; ++i)
+            {
+                const Int iGlob = globalRow(i0+i);
+                if (uplo == LOWER ? iGlob >= jGlob : iGlob <= jGlob)
+                    CBuf[i+j*CLDim] += DBuf[i+j*DLDim];
+            }
+        }
+    };
+
+#ifdef EL_HYBRID
+    auto updateTileTask = [&](Int t)
+    {
+# ifdef HYDROGEN_HAVE_MKL
+        const int oldNumThreads = mkl::SetNumThreadsLocal(1);
+        updateTile(t);
+        mkl::SetNumThreadsLocal(oldNumThreads);
+# else
+        updateTile(t);
+# endif
+    };
+# if defined(HYDROGEN_HAVE_OMP_TASKLOOP)
+    #pragma omp taskloop default(shared) grainsize(1)
+    for (Int t=0; t<numTiles; ++t)
+        updateTileTask(t);
+# else
+    #pragma omp parallel
+    #pragma omp single
+    for (Int t=0; t<numTiles; ++t)
+    {
+        #pragma omp task default(shared) firstprivate(t)
+        updateTileTask(t);
+    }
+# endif
+#else
+    for (Int t=0; t<numTiles; ++t)
+        updateTile(t);
+#endif
+}
+
 // Local C := alpha A B + C
 template<typename T>
 void TrrkNN
@@ -691,7 +847,15 @@ void LocalTrrk
     const Grid& g = C.Grid();
     ScaleTrapezoid(beta, uplo, C);
 
-    if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
+    const Int tileSize = TaskTileSize<T>(C.LocalHeight(), C.LocalWidth());
+    if (tileSize > 0)
+    {
+        TiledTrrk
+        (uplo, NORMAL, NORMAL, alpha, A.LockedMatrix(), B.LockedMatrix(),
+         C.Matrix(), tileSize,
+         C.ColShift(), C.ColStride(), C.RowShift(), C.RowStride());
+    }
+    else if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
     {
         LocalTrrkKernel(uplo, alpha, A, B, C);
     }
@@ -742,7 +906,15 @@ void LocalTrrk
     const Grid& g = C.Grid();
     ScaleTrapezoid(beta, uplo, C);
 
-    if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
+    const Int tileSize = TaskTileSize<T>(C.LocalHeight(), C.LocalWidth());
+    if (tileSize > 0)
+    {
+        TiledTrrk
+        (uplo, NORMAL, orientationOfB, alpha, A.LockedMatrix(), B.LockedMatrix(),
+         C.Matrix(), tileSize,
+         C.ColShift(), C.ColStride(), C.RowShift(), C.RowStride());
+    }
+    else if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
     {
         LocalTrrkKernel(uplo, orientationOfB, alpha, A, B, C);
     }
@@ -793,7 +965,15 @@ void LocalTrrk
     const Grid& g = C.Grid();
     ScaleTrapezoid(beta, uplo, C);
 
-    if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
+    const Int tileSize = TaskTileSize<T>(C.LocalHeight(), C.LocalWidth());
+    if (tileSize > 0)
+    {
+        TiledTrrk
+        (uplo, orientationOfA, NORMAL, alpha, A.LockedMatrix(), B.LockedMatrix(),
+         C.Matrix(), tileSize,
+         C.ColShift(), C.ColStride(), C.RowShift(), C.RowStride());
+    }
+    else if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
     {
         LocalTrrkKernel(uplo, orientationOfA, alpha, A, B, C);
     }
@@ -844,7 +1024,15 @@ void LocalTrrk
     const Grid& g = C.Grid();
     ScaleTrapezoid(beta, uplo, C);
 
-    if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
+    const Int tileSize = TaskTileSize<T>(C.LocalHeight(), C.LocalWidth());
+    if (tileSize > 0)
+    {
+        TiledTrrk
+        (uplo, orientationOfA, orientationOfB, alpha, A.LockedMatrix(), B.LockedMatrix(),
+         C.Matrix(), tileSize,
+         C.ColShift(), C.ColStride(), C.RowShift(), C.RowStride());
+    }
+    else if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
     {
         LocalTrrkKernel(uplo, orientationOfA, orientationOfB, alpha, A, B, C);
     }
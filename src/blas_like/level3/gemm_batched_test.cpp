@@ -0,0 +1,105 @@
+// MUST include this
+#include <catch2/catch.hpp>
+
+// File being tested
+#include <El.hpp>
+
+#include <vector>
+
+using namespace El;
+
+namespace
+{
+
+template <typename T>
+void FillMatrix(Matrix<T>& X, Int height, Int width, Int seed)
+{
+    X.Resize(height, width, height+seed%3);
+    for (Int j=0; j<width; ++j)
+        for (Int i=0; i<height; ++i)
+            X(i,j) = T((i+2*j+seed) % 7) - T(3);
+}
+
+template <typename T>
+void CheckBatch(Orientation orientA, Orientation orientB,
+                std::vector<Int> const& sizes)
+{
+    const T alpha = T(3), beta = T(-2);
+    const Int batchCount = sizes.size();
+    std::vector<Matrix<T>> A(batchCount), B(batchCount), C(batchCount),
+        CRef(batchCount);
+    for (Int l=0; l<batchCount; ++l)
+    {
+        const Int m = sizes[l], n = sizes[l]+1, k = sizes[l]+2;
+        if (orientA == NORMAL)
+            FillMatrix(A[l], m, k, l);
+        else
+            FillMatrix(A[l], k, m, l);
+        if (orientB == NORMAL)
+            FillMatrix(B[l], k, n, l+1);
+        else
+            FillMatrix(B[l], n, k, l+1);
+        FillMatrix(C[l], m, n, l+2);
+        CRef[l] = C[l];
+        Gemm(orientA, orientB, alpha, A[l], B[l], beta, CRef[l]);
+    }
+
+    GemmBatched(orientA, orientB, alpha, A, B, beta, C);
+    for (Int l=0; l<batchCount; ++l)
+        for (Int j=0; j<C[l].Width(); ++j)
+            for (Int i=0; i<C[l].Height(); ++i)
+                REQUIRE(C[l](i,j) == CRef[l](i,j));
+}
+
+}// namespace <anon>
+
+TEMPLATE_TEST_CASE("Testing the batched CPU Gemm","[blas][gemm]",
+                   float, double, Complex<double>, Int)
+{
+    using T = TestType;
+
+    SECTION("Batches of tiny, small and large products match Gemm")
+    {
+        for (auto orientA : {NORMAL, TRANSPOSE, ADJOINT})
+            for (auto orientB : {NORMAL, TRANSPOSE, ADJOINT})
+                CheckBatch<T>(orientA, orientB, {1, 4, 14, 0, 17, 30});
+    }
+
+    SECTION("A strided batch matches Gemm on every member")
+    {
+        const Int m = 5, n = 3, k = 4, batchCount = 7;
+        const Int ALDim = m+1, BLDim = k, CLDim = m+2;
+        const Int AStride = ALDim*k+3, BStride = BLDim*n,
+            CStride = CLDim*n+1;
+        std::vector<T> A(AStride*batchCount), B(BStride*batchCount),
+            C(CStride*batchCount);
+        for (size_t i=0; i<A.size(); ++i)
+            A[i] = T(Int(i % 7) - 3);
+        for (size_t i=0; i<B.size(); ++i)
+            B[i] = T(Int(i % 5) - 2);
+        for (size_t i=0; i<C.size(); ++i)
+            C[i] = T(Int(i % 3));
+        std::vector<T> CRef(C);
+
+        for (Int l=0; l<batchCount; ++l)
+            blas::Gemm('N', 'N', m, n, k,
+                       T(2), &A[l*AStride], ALDim, &B[l*BStride], BLDim,
+                       T(1), &CRef[l*CStride], CLDim);
+        GemmStridedBatched(NORMAL, NORMAL, m, n, k,
+                           T(2), A.data(), ALDim, AStride,
+                           B.data(), BLDim, BStride,
+                           T(1), C.data(), CLDim, CStride,
+                           batchCount);
+        for (size_t i=0; i<C.size(); ++i)
+            REQUIRE(C[i] == CRef[i]);
+    }
+
+    SECTION("Nonconformal members are rejected")
+    {
+        std::vector<Matrix<T>> A(1), B(1), C(1);
+        A[0].Resize(2, 3);
+        B[0].Resize(2, 2);
+        C[0].Resize(2, 2);
+        CHECK_THROWS(GemmBatched(NORMAL, NORMAL, T(1), A, B, T(0), C));
+    }
+}
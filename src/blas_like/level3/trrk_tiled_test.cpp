@@ -0,0 +1,151 @@
+// MUST include this
+#include <catch2/catch.hpp>
+
+// File being tested
+#include <El.hpp>
+#include "./Trrk/Local.hpp"
+
+#include <vector>
+
+using namespace El;
+
+namespace
+{
+
+struct TileCase
+{
+    Int height, width, innerDim, tileSize;
+    Int colShift, colStride, rowShift, rowStride;
+};
+
+// Views the height x width block at (offset,offset+1) of a larger matrix so
+// that the leading dimension exceeds the height
+template <typename T>
+void FillView(Matrix<T>& Parent, Matrix<T>& X,
+              Int height, Int width, Int offset, Int seed)
+{
+    Parent.Resize(height+offset+2, width+offset+3);
+    for (Int j=0; j<Parent.Width(); ++j)
+        for (Int i=0; i<Parent.Height(); ++i)
+            Parent(i,j) = T((i+3*j+seed) % 7 - 3);
+    View(X, Parent, IR(offset,offset+height), IR(offset+1,offset+1+width));
+}
+
+template <typename T>
+void RecursiveTrrk(UpperOrLower uplo,
+                   Orientation orientA, Orientation orientB,
+                   T alpha, Matrix<T> const& A, Matrix<T> const& B,
+                   Matrix<T>& C)
+{
+    if (orientA == NORMAL && orientB == NORMAL)
+        trrk::TrrkNN(uplo, alpha, A, B, C);
+    else if (orientA == NORMAL)
+        trrk::TrrkNT(uplo, orientB, alpha, A, B, C);
+    else if (orientB == NORMAL)
+        trrk::TrrkTN(uplo, orientA, alpha, A, B, C);
+    else
+        trrk::TrrkTT(uplo, orientA, orientB, alpha, A, B, C);
+}
+
+template <typename T>
+void CheckTiledTrrk(UpperOrLower uplo,
+                    Orientation orientA, Orientation orientB,
+                    TileCase const& c)
+{
+    const T alpha = T(2);
+    const Int m = c.height, n = c.width, k = c.innerDim;
+    Matrix<T> AParent, BParent, CParent, A, B, C;
+    if (orientA == NORMAL)
+        FillView(AParent, A, m, k, 1, 0);
+    else
+        FillView(AParent, A, k, m, 1, 0);
+    if (orientB == NORMAL)
+        FillView(BParent, B, k, n, 2, 1);
+    else
+        FillView(BParent, B, n, k, 2, 1);
+    FillView(CParent, C, m, n, 3, 2);
+
+    // The full product, added into the entries of the global triangle
+    Matrix<T> CParentRef(CParent), D;
+    Gemm(orientA, orientB, alpha, A, B, D);
+    for (Int j=0; j<n; ++j)
+    {
+        const Int jGlob = c.rowShift + j*c.rowStride;
+        for (Int i=0; i<m; ++i)
+        {
+            const Int iGlob = c.colShift + i*c.colStride;
+            if (uplo == LOWER ? iGlob >= jGlob : iGlob <= jGlob)
+                CParentRef(i+3,j+4) += D(i,j);
+        }
+    }
+
+    trrk::TiledTrrk(uplo, orientA, orientB, alpha, A, B, C, c.tileSize,
+                    c.colShift, c.colStride, c.rowShift, c.rowStride);
+    for (Int j=0; j<CParent.Width(); ++j)
+        for (Int i=0; i<CParent.Height(); ++i)
+            REQUIRE(CParent(i,j) == CParentRef(i,j));
+}
+
+template <typename T>
+void CheckAgainstRecursive(UpperOrLower uplo,
+                           Orientation orientA, Orientation orientB,
+                           Int n, Int k, Int tileSize)
+{
+    const T alpha = T(-3);
+    Matrix<T> AParent, BParent, CParent, A, B, C;
+    if (orientA == NORMAL)
+        FillView(AParent, A, n, k, 1, 3);
+    else
+        FillView(AParent, A, k, n, 1, 3);
+    if (orientB == NORMAL)
+        FillView(BParent, B, k, n, 2, 4);
+    else
+        FillView(BParent, B, n, k, 2, 4);
+    FillView(CParent, C, n, n, 1, 5);
+
+    Matrix<T> CRef(C);
+    const Int oldBlocksize = LocalTrrkBlocksize<T>();
+    SetLocalTrrkBlocksize<T>(4);
+    RecursiveTrrk(uplo, orientA, orientB, alpha, A, B, CRef);
+    SetLocalTrrkBlocksize<T>(oldBlocksize);
+
+    trrk::TiledTrrk(uplo, orientA, orientB, alpha, A, B, C, tileSize);
+    for (Int j=0; j<n; ++j)
+        for (Int i=0; i<n; ++i)
+            REQUIRE(C(i,j) == CRef(i,j));
+}
+
+}// namespace <anon>
+
+TEMPLATE_TEST_CASE("Testing the tiled local Trrk","[blas][trrk]",
+                   double, Complex<double>)
+{
+    using T = TestType;
+    const std::vector<UpperOrLower> uplos = { LOWER, UPPER };
+    const std::vector<Orientation> orients = { NORMAL, TRANSPOSE, ADJOINT };
+
+    SECTION("Square updates match the recursive path")
+    {
+        for (auto uplo : uplos)
+            for (auto orientA : orients)
+                for (auto orientB : orients)
+                {
+                    CheckAgainstRecursive<T>(uplo, orientA, orientB, 23, 9, 5);
+                    CheckAgainstRecursive<T>(uplo, orientA, orientB, 8, 3, 8);
+                }
+    }
+
+    SECTION("Nonsquare views with shifts and strides update the triangle")
+    {
+        const std::vector<TileCase> cases =
+          { { 17, 29, 7, 4, 3, 2, 1, 3 },
+            { 31, 13, 6, 6, 0, 3, 5, 1 },
+            { 11, 19, 5, 3, 2, 5, 4, 3 },
+            { 20, 20, 4, 7, 1, 1, 0, 1 } };
+        for (auto const& c : cases)
+            for (auto uplo : uplos)
+                for (auto orientA : orients)
+                    for (auto orientB : orients)
+                        CheckTiledTrrk<T>(uplo, orientA, orientB, c);
+    }
+}
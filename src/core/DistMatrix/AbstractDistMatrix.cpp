@@ -14,6 +14,20 @@
 namespace El
 {
 
+namespace
+{
+Int queueRoundSize_ = Int(1) << 20;
+} // namespace <anon>
+
+Int QueueRoundSize() { return queueRoundSize_; }
+
+void SetQueueRoundSize(Int roundSize)
+{
+    if (roundSize < 1)
+        LogicError("The queue round size must be positive, not ",roundSize);
+    queueRoundSize_ = roundSize;
+}
+
 // Public section
 // ##############
 
@@ -555,7 +555,7 @@ template <typename T, Device D>
 void BDM::ProcessQueues(bool includeViewers)
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const Int totalSend = remoteUpdates_.size();
@@ -640,7 +640,7 @@ template <typename T, Device D>
 void BDM::ProcessPullQueue(T* pullBuf, bool includeViewers) const
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const int root = this->Root();
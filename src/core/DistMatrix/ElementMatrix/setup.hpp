@@ -692,73 +692,155 @@ template <typename T, Device D>
 void DM::ProcessQueues(bool includeViewers)
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
-    const Int totalSend = remoteUpdates_.size();
-    LogicError("Test.");
+    if (!includeViewers && !this->Participating())
+        return;
 
     // We will first push to redundant rank 0
     const int redundantRoot = 0;
 
-    // Compute the metadata
-    // ====================
     mpi::Comm const& comm
         = (includeViewers ? grid.ViewingComm() : grid.VCComm());
-    vector<int> sendCounts, owners(totalSend);
-    if (includeViewers)
+    const int commSize = mpi::Size(comm);
+    SyncInfo<Device::CPU> cpu_si;
+
+    // Each update is sent as its offset within the local matrix of its
+    // owner, stored as if its columns were contiguous, rather than as its
+    // global coordinates
+    const int colStride = ColStride();
+    vector<Int> ownerHeights(colStride);
+    for (int rowOwner=0; rowOwner<colStride; ++rowOwner)
+        ownerHeights[rowOwner] = this->LocalRowOffset(this->Height(), rowOwner);
+
+    // Bound the size of the buffers by exchanging the queue in rounds, all
+    // of which every process must join
+    const Int totalQueued = remoteUpdates_.size();
+    const Int roundSize = QueueRoundSize();
+    const Int numRounds =
+      mpi::AllReduce((totalQueued+roundSize-1)/roundSize, mpi::MAX, comm,
+                     cpu_si);
+
+    vector<int> owners, sendCounts(commSize), sendOffs(commSize),
+      recvCounts(commSize), recvOffs(commSize);
+    vector<std::pair<Int,T>> sorted;
+    vector<Int> offsets, sendIndices, recvIndices;
+    vector<T> sendValues, recvValues;
+    for (Int round=0; round<numRounds; ++round)
     {
-        const int viewingSize = mpi::Size(grid.ViewingComm());
-        sendCounts.resize(viewingSize,0);
-        for(Int k=0; k<totalSend; ++k)
+        const Int first = Min(round*roundSize, totalQueued);
+        const Int numUpdates = Min(roundSize, totalQueued-first);
+        const Entry<T>* updates = remoteUpdates_.data() + first;
+
+        // Sort the updates by destination
+        // ===============================
+        // The owners and local offsets are computed in parallel so that the
+        // scatter into per-process segments is a single cheap serial pass
+        owners.resize(numUpdates);
+        offsets.resize(numUpdates);
+        EL_PARALLEL_FOR
+        for (Int k=0; k<numUpdates; ++k)
         {
-            const Entry<T>& entry = remoteUpdates_[k];
-            const int distOwner = this->Owner(entry.i,entry.j);
+            const Entry<T>& entry = updates[k];
+            const int distOwner = this->Owner(entry.i, entry.j);
             const int vcOwner =
               grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            owners[k] = grid.VCToViewing(vcOwner);
+            owners[k] = (includeViewers ? grid.VCToViewing(vcOwner) : vcOwner);
+            const int rowOwner = this->RowOwner(entry.i);
+            const int colOwner = this->ColOwner(entry.j);
+            offsets[k] =
+              this->LocalRowOffset(entry.i,rowOwner) +
+              this->LocalColOffset(entry.j,colOwner)*ownerHeights[rowOwner];
+        }
+        std::fill(sendCounts.begin(), sendCounts.end(), 0);
+        for (Int k=0; k<numUpdates; ++k)
             ++sendCounts[owners[k]];
+        Scan(sendCounts, sendOffs);
+        sorted.resize(numUpdates);
+        {
+            auto offs = sendOffs;
+            for (Int k=0; k<numUpdates; ++k)
+                sorted[offs[owners[k]]++] =
+                  std::make_pair(offsets[k], updates[k].value);
         }
-    }
-    else
-    {
+
+        // Combine the updates of the same entry
+        // =====================================
+        // The sort is stable so that duplicates are summed in the order in
+        // which they were queued
+        sendIndices.resize(numUpdates);
+        sendValues.resize(numUpdates);
+        EL_PARALLEL_FOR
+        for (int q=0; q<commSize; ++q)
+        {
+            auto begin = sorted.begin() + sendOffs[q];
+            auto end = begin + sendCounts[q];
+            std::stable_sort(
+              begin, end,
+              [](const std::pair<Int,T>& a, const std::pair<Int,T>& b)
+              { return a.first < b.first; });
+            Int numCombined = 0;
+            for (auto it=begin; it!=end; ++it)
+            {
+                const Int k = sendOffs[q] + numCombined;
+                if (numCombined > 0 && sendIndices[k-1] == it->first)
+                {
+                    sendValues[k-1] += it->second;
+                }
+                else
+                {
+                    sendIndices[k] = it->first;
+                    sendValues[k] = it->second;
+                    ++numCombined;
+                }
+            }
+            sendCounts[q] = numCombined;
+        }
+
+        // Exchange the updates
+        // ====================
+        // Since the updates for each process may have shrunk, the send
+        // buffers may contain gaps between the per-process segments
+        mpi::AllToAll(
+          sendCounts.data(), 1, recvCounts.data(), 1, comm, cpu_si);
+        Int numRecv = Scan(recvCounts, recvOffs);
+        recvIndices.resize(numRecv);
+        recvValues.resize(numRecv);
+        mpi::AllToAll(
+          sendIndices.data(), sendCounts.data(), sendOffs.data(),
+          recvIndices.data(), recvCounts.data(), recvOffs.data(), comm,
+          cpu_si);
+        mpi::AllToAll(
+          sendValues.data(), sendCounts.data(), sendOffs.data(),
+          recvValues.data(), recvCounts.data(), recvOffs.data(), comm,
+          cpu_si);
         if (!this->Participating())
-            return;
-        const int vcSize = mpi::Size(grid.VCComm());
-        sendCounts.resize(vcSize,0);
-        for(Int k=0; k<totalSend; ++k)
+            continue;
+        if (RedundantSize() > 1)
         {
-            const Entry<T>& entry = remoteUpdates_[k];
-            const int distOwner = this->Owner(entry.i,entry.j);
-            owners[k] =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            ++sendCounts[owners[k]];
+            mpi::Broadcast(numRecv, redundantRoot, RedundantComm(), cpu_si);
+            recvIndices.resize(numRecv);
+            recvValues.resize(numRecv);
+            mpi::Broadcast(
+              recvIndices.data(), numRecv, redundantRoot, RedundantComm(),
+              cpu_si);
+            mpi::Broadcast(
+              recvValues.data(), numRecv, redundantRoot, RedundantComm(),
+              cpu_si);
         }
-    }
 
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan(sendCounts, sendOffs);
-    vector<Entry<T>> sendBuf(totalSend);
-    auto offs = sendOffs;
-    for(Int k=0; k<totalSend; ++k)
-        sendBuf[offs[owners[k]]++] = remoteUpdates_[k];
+        // Apply the updates
+        // =================
+        const Int localHeight = this->LocalHeight();
+        for (Int k=0; k<numRecv; ++k)
+        {
+            const Int offset = recvIndices[k];
+            UpdateLocal(offset % localHeight, offset / localHeight,
+                        recvValues[k]);
+        }
+    }
     SwapClear(remoteUpdates_);
-
-    // Exchange and unpack the data
-    // ============================
-    SyncInfo<Device::CPU> cpu_si;
-    auto recvBuf = mpi::AllToAll(sendBuf, sendCounts, sendOffs, comm);
-    Int recvBufSize = recvBuf.size();
-    mpi::Broadcast(recvBufSize, redundantRoot, RedundantComm(), cpu_si);
-    recvBuf.resize(recvBufSize);
-    mpi::Broadcast(
-        recvBuf.data(), recvBufSize, redundantRoot, RedundantComm(), cpu_si);
-    // TODO: Make this loop faster
-    for(const auto& entry : recvBuf)
-        UpdateLocal(this->LocalRow(entry.i), this->LocalCol(entry.j),
-                    entry.value);
 }
 
 template <typename T, Device D>
@@ -779,91 +861,100 @@ template <typename T, Device D>
 void DM::ProcessPullQueue(T* pullBuf, bool includeViewers) const
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const int root = this->Root();
-    const Int totalRecv = remotePulls_.size();
-
-    LogicError("Test.");
+    if (!includeViewers && !this->Participating())
+        return;
 
-    // Compute the metadata
-    // ====================
     mpi::Comm const& comm
         = (includeViewers ? grid.ViewingComm() : grid.VCComm());
     int const commSize = comm.Size();
-    vector<int> recvCounts, owners(totalRecv);
-    if (includeViewers)
+    SyncInfo<Device::CPU> cpu_si;
+
+    // As in ProcessQueues, each entry is requested by its offset within the
+    // local matrix of its owner, and the queue is processed in rounds
+    const int colStride = ColStride();
+    vector<Int> ownerHeights(colStride);
+    for (int rowOwner=0; rowOwner<colStride; ++rowOwner)
+        ownerHeights[rowOwner] = this->LocalRowOffset(this->Height(), rowOwner);
+
+    const Int totalQueued = remotePulls_.size();
+    const Int roundSize = QueueRoundSize();
+    const Int numRounds =
+      mpi::AllReduce((totalQueued+roundSize-1)/roundSize, mpi::MAX, comm,
+                     cpu_si);
+
+    vector<int> owners, recvCounts(commSize), recvOffs(commSize),
+      sendCounts(commSize), sendOffs(commSize);
+    vector<Int> offsets, recvIndices, sendIndices;
+    vector<T> sendBuf, recvBuf;
+    for (Int round=0; round<numRounds; ++round)
     {
-        recvCounts.resize(commSize,0);
-        for(Int k=0; k<totalRecv; ++k)
+        const Int first = Min(round*roundSize, totalQueued);
+        const Int numRecv = Min(roundSize, totalQueued-first);
+        const ValueInt<Int>* pulls = remotePulls_.data() + first;
+
+        // Compute the metadata
+        // ====================
+        owners.resize(numRecv);
+        offsets.resize(numRecv);
+        EL_PARALLEL_FOR
+        for (Int k=0; k<numRecv; ++k)
         {
-            const auto& valueInt = remotePulls_[k];
-            const Int i = valueInt.value;
-            const Int j = valueInt.index;
-            const int distOwner = this->Owner(i,j);
+            const Int i = pulls[k].value;
+            const Int j = pulls[k].index;
+            const int distOwner = this->Owner(i, j);
             const int vcOwner = grid.CoordsToVC(colDist,rowDist,distOwner,root);
-            const int owner = grid.VCToViewing(vcOwner);
-            owners[k] = owner;
-            ++recvCounts[owner];
+            owners[k] = (includeViewers ? grid.VCToViewing(vcOwner) : vcOwner);
+            const int rowOwner = this->RowOwner(i);
+            offsets[k] =
+              this->LocalRowOffset(i,rowOwner) +
+              this->LocalColOffset(j,this->ColOwner(j))*ownerHeights[rowOwner];
         }
-    }
-    else
-    {
-        if (!this->Participating())
-            return;
-        recvCounts.resize(commSize,0);
-        for(Int k=0; k<totalRecv; ++k)
+        std::fill(recvCounts.begin(), recvCounts.end(), 0);
+        for (Int k=0; k<numRecv; ++k)
+            ++recvCounts[owners[k]];
+        Scan(recvCounts, recvOffs);
+        mpi::AllToAll(recvCounts.data(), 1, sendCounts.data(), 1, comm,
+                      cpu_si);
+        const Int numSend = Scan(sendCounts, sendOffs);
+
+        recvIndices.resize(numRecv);
         {
-            const auto& valueInt = remotePulls_[k];
-            const Int i = valueInt.value;
-            const Int j = valueInt.index;
-            const int distOwner = this->Owner(i,j);
-            const int owner = grid.CoordsToVC(colDist,rowDist,distOwner,root);
-            owners[k] = owner;
-            ++recvCounts[owner];
+            auto offs = recvOffs;
+            for (Int k=0; k<numRecv; ++k)
+                recvIndices[offs[owners[k]]++] = offsets[k];
+        }
+        sendIndices.resize(numSend);
+        mpi::AllToAll(
+          recvIndices.data(), recvCounts.data(), recvOffs.data(),
+          sendIndices.data(), sendCounts.data(), sendOffs.data(), comm,
+          cpu_si);
+
+        // Pack the data
+        // =============
+        const Int localHeight = this->LocalHeight();
+        FastResize(sendBuf, numSend);
+        EL_PARALLEL_FOR
+        for (Int k=0; k<numSend; ++k)
+        {
+            const Int offset = sendIndices[k];
+            sendBuf[k] = GetLocal(offset % localHeight, offset / localHeight);
         }
-    }
-    vector<int> recvOffs;
-    Scan(recvCounts, recvOffs);
-    vector<int> sendCounts(commSize);
-    mpi::AllToAll(recvCounts.data(), 1, sendCounts.data(), 1, comm,
-                  SyncInfo<Device::CPU>{});
-    vector<int> sendOffs;
-    const int totalSend = Scan(sendCounts, sendOffs);
-
-    auto offs = recvOffs;
-    vector<ValueInt<Int>> recvCoords(totalRecv);
-    for(Int k=0; k<totalRecv; ++k)
-        recvCoords[offs[owners[k]]++] = remotePulls_[k];
-    vector<ValueInt<Int>> sendCoords(totalSend);
-    mpi::AllToAll(
-        recvCoords.data(), recvCounts.data(), recvOffs.data(),
-        sendCoords.data(), sendCounts.data(), sendOffs.data(), comm,
-        SyncInfo<Device::CPU>{});
-
-    // Pack the data
-    // =============
-    vector<T> sendBuf;
-    FastResize(sendBuf, totalSend);
-    for(Int k=0; k<totalSend; ++k)
-    {
-        const Int i = sendCoords[k].value;
-        const Int j = sendCoords[k].index;
-        sendBuf[k] = GetLocal(this->LocalRow(i), this->LocalCol(j));
-    }
 
-    // Exchange and unpack the data
-    // ============================
-    vector<T> recvBuf;
-    FastResize(recvBuf, totalRecv);
-    mpi::AllToAll(
-        sendBuf.data(), sendCounts.data(), sendOffs.data(),
-        recvBuf.data(), recvCounts.data(), recvOffs.data(), comm,
-        SyncInfo<Device::CPU>{});
-    offs = recvOffs;
-    for(Int k=0; k<totalRecv; ++k)
-        pullBuf[k] = recvBuf[offs[owners[k]]++];
+        // Exchange and unpack the data
+        // ============================
+        FastResize(recvBuf, numRecv);
+        mpi::AllToAll(
+          sendBuf.data(), sendCounts.data(), sendOffs.data(),
+          recvBuf.data(), recvCounts.data(), recvOffs.data(), comm,
+          cpu_si);
+        auto offs = recvOffs;
+        for (Int k=0; k<numRecv; ++k)
+            pullBuf[first+k] = recvBuf[offs[owners[k]]++];
+    }
     SwapClear(remotePulls_);
 }
 
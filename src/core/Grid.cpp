@@ -192,6 +192,14 @@ void Grid::SetUpGrid()
           mpi::ErrorHandlerSet( mdComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN );
         )
+
+        // Label the communicators for the communication statistics
+        mpi::SetName( mcComm_,     "MC"      );
+        mpi::SetName( mrComm_,     "MR"      );
+        mpi::SetName( vcComm_,     "VC"      );
+        mpi::SetName( vrComm_,     "VR"      );
+        mpi::SetName( mdComm_,     "MD"      );
+        mpi::SetName( mdPerpComm_, "MD_PERP" );
     }
     else
     {
@@ -428,6 +436,82 @@ int Grid::DiagRank( int vcRank ) const EL_NO_EXCEPT
         return mpi::UNDEFINED;
 }
 
+// Layers of a replicated grid
+// ===========================
+
+struct Grid::Layers
+{
+    vector<std::unique_ptr<Grid>> grids;
+    mpi::Comm depthComm;
+};
+
+const Grid::Layers& Grid::GetLayers( int depth ) const
+{
+    EL_DEBUG_CSE
+    auto iter = layers_.find( depth );
+    if( iter != layers_.end() )
+        return *iter->second;
+
+    if( !InGrid() )
+        LogicError("Only members of a grid can form its layers");
+    if( depth < 1 || size_ % depth != 0 )
+        LogicError
+        ("Grid depth ",depth," does not divide the grid size ",size_);
+
+    const int layerSize = size_ / depth;
+    auto layers = MakeUnique<Layers>();
+    vector<int> ranks(layerSize);
+    for( int layer=0; layer<depth; ++layer )
+    {
+        for( int i=0; i<layerSize; ++i )
+            ranks[i] = layer*layerSize + i;
+        mpi::Group layerGroup;
+        mpi::Incl( owningGroup_, layerSize, ranks.data(), layerGroup );
+        mpi::Comm viewers;
+        mpi::Dup( owningComm_, viewers );
+        layers->grids.emplace_back
+        ( MakeUnique<Grid>
+          ( std::move(viewers), layerGroup, DefaultHeight(layerSize),
+            order_ ) );
+        mpi::Free( layerGroup );
+    }
+    mpi::Split
+    ( owningComm_, owningRank_ % layerSize, owningRank_ / layerSize,
+      layers->depthComm );
+
+    auto& cached = layers_[depth];
+    cached = std::move(layers);
+    return *cached;
+}
+
+const Grid& Grid::LayerGrid( int depth, int layer ) const
+{
+    EL_DEBUG_CSE
+    if( layer < 0 || layer >= depth )
+        LogicError("Layer ",layer," is out of bounds for depth ",depth);
+    return *GetLayers( depth ).grids[layer];
+}
+
+int Grid::Layer( int depth ) const EL_NO_RELEASE_EXCEPT
+{
+    if( !InGrid() )
+        return mpi::UNDEFINED;
+    return owningRank_ / (size_/depth);
+}
+
+mpi::Comm const& Grid::DepthComm( int depth ) const
+{ return GetLayers( depth ).depthComm; }
+
+std::shared_ptr<const GemmCostModel>&
+Grid::CachedGemmCostModel( Device D ) const
+{ return gemmCostModels_[D]; }
+
+std::shared_ptr<void>& Grid::CachedRedistPlan( std::type_index type ) const
+{ return redistPlans_[type]; }
+
+Grid::PhiloxStreams& Grid::CachedPhiloxStreams() const
+{ return philoxStreams_; }
+
 #ifdef EL_HAVE_SCALAPACK
 int Grid::BlacsVCHandle() const { return blacsVCHandle_; }
 int Grid::BlacsVRHandle() const { return blacsVRHandle_; }
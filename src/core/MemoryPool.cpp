@@ -1,4 +1,8 @@
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
 #include <memory>
+#include <string>
 #include "El-lite.hpp"
 #include "El/core/MemoryPool.hpp"
 
@@ -11,6 +15,23 @@ namespace
 std::unique_ptr<MemoryPool<true>> pinnedHostMemoryPool_;
 #endif  // HYDROGEN_HAVE_GPU
 std::unique_ptr<MemoryPool<false>> hostMemoryPool_;
+
+/** Cap on the bytes each host pool caches, from H_MEMPOOL_MAX_CACHED_SIZE. */
+size_t get_max_cached_size() noexcept
+{
+    size_t const unlimited = std::numeric_limits<size_t>::max();
+    char const* env = std::getenv("H_MEMPOOL_MAX_CACHED_SIZE");
+    if (!env)
+        return unlimited;
+    // Ignore a malformed or out-of-range value.
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long const bytes = std::strtoull(env, &end, 10);
+    if (end == env || *end != '\0' || errno == ERANGE
+        || bytes > static_cast<unsigned long long>(unlimited))
+        return unlimited;
+    return static_cast<size_t>(bytes);
+}
 }  // namespace <anon>
 
 #ifdef HYDROGEN_HAVE_GPU
@@ -18,7 +39,10 @@ std::unique_ptr<MemoryPool<false>> hostMemoryPool_;
 MemoryPool<true>& PinnedHostMemoryPool()
 {
     if (!pinnedHostMemoryPool_)
+    {
         pinnedHostMemoryPool_.reset(new MemoryPool<true>());
+        pinnedHostMemoryPool_->SetMaxCachedBytes(get_max_cached_size());
+    }
     return *pinnedHostMemoryPool_;
 }
 
@@ -30,7 +54,10 @@ void DestroyPinnedHostMemoryPool()
 MemoryPool<false>& HostMemoryPool()
 {
     if (!hostMemoryPool_)
+    {
         hostMemoryPool_.reset(new MemoryPool<false>());
+        hostMemoryPool_->SetMaxCachedBytes(get_max_cached_size());
+    }
     return *hostMemoryPool_;
 }
 
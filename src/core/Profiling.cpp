@@ -3,6 +3,8 @@
 
 #include "El/hydrogen_config.h"
 #include "El/core/Profiling.hpp"
+#include "Trace.hpp"
+#include "imports/mpi_stats.hpp"
 
 #ifdef HYDROGEN_HAVE_NVPROF
 #include "nvToolsExt.h"
@@ -123,6 +125,9 @@ void BeginRegionProfile(char const* s, Color c) noexcept
     }
 #endif // HYDROGEN_HAVE_VTUNE
 
+    trace::Begin(s);
+    mpi::stats::BeginRegion(s);
+
     // Just so there are no nasty compiler warnings
     (void) s;
     (void) c;
@@ -139,5 +144,8 @@ void EndRegionProfile(const char *) noexcept
     if (VTuneRuntimeEnabled())
         __itt_task_end(GetVTuneDomain());
 #endif // HYDROGEN_HAVE_VTUNE
+
+    mpi::stats::EndRegion();
+    trace::End();
 }
 } // namespace El
@@ -0,0 +1,431 @@
+#include <El.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "Trace.hpp"
+
+namespace El
+{
+
+namespace
+{
+
+using trace_clock = std::chrono::steady_clock;
+
+struct TraceEvent
+{
+    std::uint64_t time;// Nanoseconds since the trace epoch
+    std::uint32_t region;
+    bool begin;
+};
+
+// A region that is open on a thread, tagged with the tracing session it
+// began in
+struct ActiveRegion
+{
+    std::uint32_t region;
+    std::uint64_t session;
+};
+
+// A thread-local cache entry of a global region id. The cache is keyed on
+// the address of the description, which is compared against the name so
+// that a reused address is not mistaken for an earlier region.
+struct CachedRegion
+{
+    std::uint32_t id;
+    std::string name;
+};
+
+// The ring buffer of a single thread. Only the owning thread writes to
+// it, so no synchronization is needed while recording.
+struct ThreadTrace
+{
+    ThreadTrace(int id, size_t capacity)
+        : tid{id}, events(capacity)
+    {}
+
+    int tid;
+    std::vector<TraceEvent> events;
+    std::uint64_t num_recorded = 0;
+    // The traced regions that are currently open on this thread
+    std::vector<ActiveRegion> open_regions;
+    // Thread-local cache of the global region ids
+    std::unordered_map<char const*, CachedRegion> region_ids;
+
+    template <typename F>
+    void ForEachEvent(F f) const
+    {
+        const std::uint64_t capacity = events.size();
+        const std::uint64_t first =
+            (num_recorded > capacity ? num_recorded - capacity : 0);
+        for (std::uint64_t e = first; e < num_recorded; ++e)
+            f(events[e % capacity]);
+    }
+};
+
+std::atomic<bool> tracing_enabled{false};
+// Incremented whenever tracing is enabled. Regions are neither pushed nor
+// popped while tracing is disabled, so a region that is still open from
+// an earlier session can no longer be matched with its end.
+std::atomic<std::uint64_t> tracing_session{0};
+std::atomic<size_t> events_per_thread{size_t(1) << 20};
+trace_clock::time_point trace_epoch = trace_clock::now();
+std::string trace_prefix;
+
+// Registration of threads and region names is rare and takes a lock
+std::mutex trace_mutex;
+std::vector<std::unique_ptr<ThreadTrace>> thread_traces;
+std::vector<std::string> region_names;
+std::unordered_map<std::string, std::uint32_t> region_name_ids;
+
+thread_local ThreadTrace* local_trace = nullptr;
+
+ThreadTrace* GetLocalTrace()
+{
+    if (!local_trace)
+    {
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        thread_traces.emplace_back(
+            new ThreadTrace(int(thread_traces.size()),
+                            Max(events_per_thread.load(), size_t(1))));
+        local_trace = thread_traces.back().get();
+    }
+    return local_trace;
+}
+
+std::uint32_t GetRegionId(ThreadTrace& tt, char const* desc)
+{
+    auto& cached = tt.region_ids[desc];
+    if (!cached.name.empty() && cached.name == desc)
+        return cached.id;
+
+    std::string name(desc);
+    std::uint32_t id;
+    {
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        auto global_it = region_name_ids.find(name);
+        if (global_it == region_name_ids.end())
+        {
+            id = std::uint32_t(region_names.size());
+            region_names.push_back(name);
+            region_name_ids.emplace(name, id);
+        }
+        else
+            id = global_it->second;
+    }
+    cached.id = id;
+    cached.name = std::move(name);
+    return id;
+}
+
+std::uint64_t Now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        trace_clock::now() - trace_epoch).count();
+}
+
+void Record(ThreadTrace& tt, std::uint32_t region, bool begin) noexcept
+{
+    auto& event = tt.events[tt.num_recorded % tt.events.size()];
+    event.time = Now();
+    event.region = region;
+    event.begin = begin;
+    ++tt.num_recorded;
+}
+
+std::string EscapeJSON(std::string const& str)
+{
+    std::string escaped;
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+struct RegionStats
+{
+    std::uint64_t calls = 0;
+    double inclusive = 0.;// seconds
+    double exclusive = 0.;// seconds
+};
+
+// Pair up the begin and end events of every thread and accumulate the
+// time spent in each region. Events whose partner was overwritten (or
+// that have not yet ended) are skipped.
+std::map<std::string, RegionStats> LocalRegionStats()
+{
+    struct OpenRegion
+    {
+        std::uint32_t region;
+        std::uint64_t begin;
+        std::uint64_t child_time;
+    };
+
+    std::map<std::string, RegionStats> stats;
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    for (auto const& tt : thread_traces)
+    {
+        std::vector<OpenRegion> stack;
+        tt->ForEachEvent(
+            [&](TraceEvent const& event)
+            {
+                if (event.begin)
+                {
+                    stack.push_back({event.region, event.time, 0});
+                    return;
+                }
+                if (stack.empty() || stack.back().region != event.region)
+                    return;
+                const auto open = stack.back();
+                stack.pop_back();
+                const std::uint64_t inclusive = event.time - open.begin;
+                auto& s = stats[region_names[open.region]];
+                ++s.calls;
+                s.inclusive += 1.e-9*inclusive;
+                s.exclusive += 1.e-9*(inclusive - open.child_time);
+                if (!stack.empty())
+                    stack.back().child_time += inclusive;
+            });
+    }
+    return stats;
+}
+
+}// namespace <anon>
+
+void EnableRegionTracing(size_t eventsPerThread) noexcept
+{
+    events_per_thread = eventsPerThread;
+    if (!tracing_enabled.load())
+    {
+        ++tracing_session;
+        tracing_enabled = true;
+    }
+}
+
+void DisableRegionTracing() noexcept
+{
+    tracing_enabled = false;
+}
+
+bool RegionTracingEnabled() noexcept
+{
+    return tracing_enabled.load(std::memory_order_relaxed);
+}
+
+void ClearTrace() noexcept
+{
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    for (auto& tt : thread_traces)
+        tt->num_recorded = 0;
+}
+
+void WriteTrace(std::string const& filename)
+{
+    EL_DEBUG_CSE
+    std::ofstream file(filename);
+    if (!file.is_open())
+        RuntimeError("Could not open ",filename);
+
+    const int rank = mpi::Rank(mpi::COMM_WORLD);
+    file << "{\"traceEvents\":[";
+    bool first = true;
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    for (auto const& tt : thread_traces)
+    {
+        tt->ForEachEvent(
+            [&](TraceEvent const& event)
+            {
+                file << (first ? "\n" : ",\n")
+                     << "{\"name\":\""
+                     << EscapeJSON(region_names[event.region])
+                     << "\",\"ph\":\"" << (event.begin ? 'B' : 'E')
+                     << "\",\"pid\":" << rank
+                     << ",\"tid\":" << tt->tid
+                     << ",\"ts\":" << std::fixed << std::setprecision(3)
+                     << 1.e-3*event.time << "}";
+                first = false;
+            });
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void PrintTraceSummary(std::ostream& os)
+{
+    EL_DEBUG_CSE
+    mpi::Comm const& comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank(comm);
+    const int commSize = mpi::Size(comm);
+
+    // Serialize the local statistics as lines of text and gather them
+    std::ostringstream localStream;
+    localStream << std::setprecision(17);
+    for (auto const& entry : LocalRegionStats())
+        localStream << entry.first << '\t' << entry.second.calls << '\t'
+                    << entry.second.inclusive << '\t'
+                    << entry.second.exclusive << '\n';
+    const std::string localString = localStream.str();
+    const int localSize = int(localString.size());
+    vector<int> sizes(commSize), offsets(commSize);
+    mpi::Gather(
+        &localSize, 1, sizes.data(), 1, 0, comm, SyncInfo<Device::CPU>{});
+    int totalSize = 0;
+    for (int q=0; q<commSize; ++q)
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    vector<byte> allStrings(Max(totalSize,1));
+    mpi::Gather(
+        reinterpret_cast<const byte*>(localString.data()), localSize,
+        allStrings.data(), sizes.data(), offsets.data(), 0, comm,
+        SyncInfo<Device::CPU>{});
+    if (commRank != 0)
+        return;
+
+    struct GlobalStats
+    {
+        int ranks = 0;
+        std::uint64_t calls = 0;
+        double minInclusive = 0., maxInclusive = 0., sumInclusive = 0.;
+        double maxExclusive = 0., sumExclusive = 0.;
+    };
+    std::map<std::string, GlobalStats> stats;
+    for (int q=0; q<commSize; ++q)
+    {
+        std::istringstream stream(
+            std::string(
+                reinterpret_cast<const char*>(&allStrings[offsets[q]]),
+                sizes[q]));
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            const auto tab = line.find('\t');
+            std::istringstream values(line.substr(tab+1));
+            std::uint64_t calls;
+            double inclusive, exclusive;
+            values >> calls >> inclusive >> exclusive;
+
+            auto& s = stats[line.substr(0,tab)];
+            if (s.ranks == 0)
+                s.minInclusive = s.maxInclusive = inclusive;
+            s.minInclusive = Min(s.minInclusive, inclusive);
+            s.maxInclusive = Max(s.maxInclusive, inclusive);
+            s.maxExclusive = Max(s.maxExclusive, exclusive);
+            s.sumInclusive += inclusive;
+            s.sumExclusive += exclusive;
+            s.calls += calls;
+            ++s.ranks;
+        }
+    }
+
+    // Report the most expensive regions first
+    vector<std::pair<std::string,GlobalStats>> sorted(
+        stats.begin(), stats.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](std::pair<std::string,GlobalStats> const& a,
+                 std::pair<std::string,GlobalStats> const& b)
+              { return a.second.maxInclusive > b.second.maxInclusive; });
+
+    const size_t nameWidth = 32;
+    os << std::left << std::setw(nameWidth) << "Region" << std::right
+       << std::setw(8) << "Ranks" << std::setw(12) << "Calls"
+       << std::setw(14) << "Incl. min" << std::setw(14) << "Incl. avg"
+       << std::setw(14) << "Incl. max" << std::setw(14) << "Excl. avg"
+       << std::setw(14) << "Excl. max" << "\n";
+    os << std::scientific << std::setprecision(4);
+    for (auto const& entry : sorted)
+    {
+        auto const& s = entry.second;
+        os << std::left << std::setw(nameWidth) << entry.first << std::right
+           << std::setw(8) << s.ranks << std::setw(12) << s.calls
+           << std::setw(14) << s.minInclusive
+           << std::setw(14) << s.sumInclusive/s.ranks
+           << std::setw(14) << s.maxInclusive
+           << std::setw(14) << s.sumExclusive/s.ranks
+           << std::setw(14) << s.maxExclusive << "\n";
+    }
+    os << std::defaultfloat;
+}
+
+namespace trace
+{
+
+void Begin(char const* desc) noexcept
+{
+    if (!RegionTracingEnabled())
+        return;
+    try
+    {
+        auto& tt = *GetLocalTrace();
+        const std::uint32_t region = GetRegionId(tt, desc);
+        tt.open_regions.push_back({region, tracing_session.load()});
+        Record(tt, region, true);
+    }
+    catch (...)
+    {
+        // Give up on tracing rather than failing the application
+        DisableRegionTracing();
+    }
+}
+
+void End() noexcept
+{
+    if (!RegionTracingEnabled())
+        return;
+    ThreadTrace* tt = local_trace;
+    if (!tt || tt->open_regions.empty())
+        return;
+    // Regions nest, so every region that began in this session closes
+    // before one that began while tracing was disabled. An open region
+    // from an earlier session on top of the stack thus means that the
+    // ending region began untraced; the stale regions cannot be matched
+    // any more and are dropped.
+    const ActiveRegion open = tt->open_regions.back();
+    if (open.session != tracing_session.load())
+    {
+        tt->open_regions.clear();
+        return;
+    }
+    tt->open_regions.pop_back();
+    Record(*tt, open.region, false);
+}
+
+void Initialize()
+{
+    char const* env = std::getenv("H_TRACE");
+    if (env && *env)
+    {
+        trace_prefix = env;
+        trace_epoch = trace_clock::now();
+        EnableRegionTracing(events_per_thread);
+    }
+}
+
+void Finalize()
+{
+    if (trace_prefix.empty())
+        return;
+    DisableRegionTracing();
+    const int rank = mpi::Rank(mpi::COMM_WORLD);
+    WriteTrace(trace_prefix + "." + std::to_string(rank) + ".json");
+    std::ostringstream summary;
+    PrintTraceSummary(summary);
+    if (rank == 0)
+        std::cout << summary.str();
+    trace_prefix.clear();
+}
+
+}// namespace trace
+}// namespace El
@@ -0,0 +1,32 @@
+#pragma once
+#ifndef EL_CORE_TRACE_HPP_
+#define EL_CORE_TRACE_HPP_
+
+// Internal hooks of the built-in trace recorder; see EnableRegionTracing in
+// El/core/Profiling.hpp for the public interface.
+
+namespace El
+{
+namespace trace
+{
+
+/** \brief Record the beginning of a region on the calling thread. */
+void Begin(char const* desc) noexcept;
+
+/** \brief Record the end of the innermost open region on the calling
+ *      thread.
+ */
+void End() noexcept;
+
+/** \brief Enable tracing if the H_TRACE environment variable is set. */
+void Initialize();
+
+/** \brief Write the trace and the summary requested by H_TRACE.
+ *
+ *  This is collective over MPI_COMM_WORLD and must precede MPI_Finalize.
+ */
+void Finalize();
+
+}// namespace trace
+}// namespace El
+#endif /* EL_CORE_TRACE_HPP_ */
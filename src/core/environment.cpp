@@ -18,6 +18,9 @@
 #include <algorithm>
 #include <set>
 
+#include "Trace.hpp"
+#include "imports/mpi_stats.hpp"
+
 namespace {
 
 El::Int numElemInits = 0;
@@ -323,6 +326,8 @@ void Initialize( int& argc, char**& argv )
 #endif
 
     InitializeRandom();
+    trace::Initialize();
+    mpi::stats::Initialize();
 
     // Create the types and ops.
     // mpfr::SetPrecision within InitializeRandom created the BigFloat types
@@ -343,6 +348,9 @@ void Finalize()
         cerr << "Warning: MPI was finalized before Elemental." << endl;
     if( ::numElemInits == 0 )
     {
+        mpi::stats::Finalize();
+        trace::Finalize();
+
         delete ::args;
         ::args = 0;
 
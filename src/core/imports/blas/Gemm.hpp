@@ -41,6 +41,8 @@ void EL_BLAS(zgemm)
 
 } // extern "C"
 
+#include "./GemmKernel.hpp"
+
 namespace El {
 namespace blas {
 
@@ -78,187 +80,11 @@ void Gemm
                 C[i+j*CLDim] *= beta;
     }
 
-    // Naive implementation
-    T gamma, delta;
-    if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
-    {
-        // C := alpha A B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt l=0; l<k; ++l )
-            {
-                gamma = alpha;
-                gamma *= B[l+j*BLDim];
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= gamma;
-                    C[i+j*CLDim] += delta;
-                }
-            }
-        }
-    }
-    else if( std::toupper(transA) == 'N' )
-    {
-        if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    gamma = alpha;
-                    gamma *= B[j+l*BLDim];
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    Conj( B[j+l*BLDim], gamma );
-                    gamma *= alpha;
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-    }
-    else if( std::toupper(transB) == 'N' )
-    {
-        if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-    }
-    else
-    {
-        if( std::toupper(transA) == 'T' && std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^T B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( B[j+l*BLDim], delta );
-                        delta *= A[l+i*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^H B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B^H + C
-            T phi;
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        Conj( B[j+l*BLDim], phi );
-                        delta *= phi;
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-    }
+    if( m == 0 || n == 0 || k == 0 || alpha == TypeTraits<T>::Zero() )
+        return;
+    gemm::PackedGemm
+    ( char(std::toupper(transA)), char(std::toupper(transB)), m, n, k,
+      alpha, A, ALDim, B, BLDim, C, CLDim );
 }
 template void Gemm
 ( char transA, char transB,
@@ -0,0 +1,276 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// A packed, register-tiled Gemm for the element types that are not supported
+// by the vendor BLAS. Following the usual Goto/van de Geijn scheme, op(B) is
+// packed into KC x NC panels, op(A) into MC x KC blocks (one per thread), and
+// a micro-kernel accumulates MR x NR tiles of C from micro-panels of the
+// packed operands. Conjugation and type promotion happen during packing.
+
+namespace El {
+namespace blas {
+namespace gemm {
+
+// The type in which the products of T are accumulated
+template<typename T>
+struct Accumulator { typedef T type; };
+#ifdef HYDROGEN_HAVE_HALF
+template<>
+struct Accumulator<cpu_half_type> { typedef float type; };
+#endif // HYDROGEN_HAVE_HALF
+
+// Compile-time blocking parameters. MR x NR accumulators should fit in
+// registers, an MC x KC block of op(A) in the L2 cache, and a KC x NC panel
+// of op(B) in the L3 cache.
+template<typename T>
+struct Blocking
+{
+    static constexpr BlasInt MR = 4, NR = 4;
+    static constexpr BlasInt MC = 96, KC = 256, NC = 2048;
+};
+template<typename Real>
+struct Blocking<Complex<Real>>
+{
+    static constexpr BlasInt MR = 2, NR = 2;
+    static constexpr BlasInt MC = 64, KC = 128, NC = 1024;
+};
+#ifdef HYDROGEN_HAVE_HALF
+template<>
+struct Blocking<cpu_half_type>
+{
+    static constexpr BlasInt MR = 8, NR = 4;
+    static constexpr BlasInt MC = 128, KC = 256, NC = 2048;
+};
+#endif // HYDROGEN_HAVE_HALF
+#ifdef HYDROGEN_HAVE_MPC
+// Every arbitrary-precision entry owns heap memory, so there is nothing to
+// gain from register tiles; small blocks keep the packed copies cheap.
+template<>
+struct Blocking<BigInt>
+{
+    static constexpr BlasInt MR = 1, NR = 1;
+    static constexpr BlasInt MC = 64, KC = 64, NC = 256;
+};
+template<>
+struct Blocking<BigFloat>
+{
+    static constexpr BlasInt MR = 1, NR = 1;
+    static constexpr BlasInt MC = 64, KC = 64, NC = 256;
+};
+template<>
+struct Blocking<Complex<BigFloat>>
+{
+    static constexpr BlasInt MR = 1, NR = 1;
+    static constexpr BlasInt MC = 32, KC = 32, NC = 128;
+};
+#endif // HYDROGEN_HAVE_MPC
+
+// op(X)(i,j), converted to the accumulation type
+template<typename Accum,typename T>
+void LoadEntry
+( char trans, const T* X, BlasInt XLDim, BlasInt i, BlasInt j, Accum& entry )
+{
+    if( trans == 'N' )
+    {
+        entry = Accum(X[i+j*XLDim]);
+    }
+    else if( trans == 'T' )
+    {
+        entry = Accum(X[j+i*XLDim]);
+    }
+    else
+    {
+        T conjEntry;
+        Conj( X[j+i*XLDim], conjEntry );
+        entry = Accum(conjEntry);
+    }
+}
+
+// Pack op(A)(i0:i0+mc,l0:l0+kc) into micro-panels of MR rows, each stored
+// with its MR entries of a column contiguous. Rows beyond mc are zeroed.
+template<BlasInt MR,typename Accum,typename T>
+void PackA
+( char transA, const T* A, BlasInt ALDim,
+  BlasInt i0, BlasInt l0, BlasInt mc, BlasInt kc, Accum* APack )
+{
+    for( BlasInt ir=0; ir<mc; ir+=MR )
+    {
+        const BlasInt mr = Min(MR,mc-ir);
+        Accum* panel = &APack[ir*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<mr; ++i )
+                LoadEntry( transA, A, ALDim, i0+ir+i, l0+l, panel[i+l*MR] );
+            for( BlasInt i=mr; i<MR; ++i )
+                panel[i+l*MR] = TypeTraits<Accum>::Zero();
+        }
+    }
+}
+
+// Pack op(B)(l0:l0+kc,j0:j0+nc) into micro-panels of NR columns, each stored
+// with its NR entries of a row contiguous. Columns beyond nc are zeroed.
+template<BlasInt NR,typename Accum,typename T>
+void PackB
+( char transB, const T* B, BlasInt BLDim,
+  BlasInt l0, BlasInt j0, BlasInt kc, BlasInt nc, Accum* BPack )
+{
+    const BlasInt numPanels = (nc+NR-1) / NR;
+    EL_PARALLEL_FOR
+    for( BlasInt panelIndex=0; panelIndex<numPanels; ++panelIndex )
+    {
+        const BlasInt jr = panelIndex*NR;
+        const BlasInt nr = Min(NR,nc-jr);
+        Accum* panel = &BPack[jr*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<nr; ++j )
+                LoadEntry( transB, B, BLDim, l0+l, j0+jr+j, panel[j+l*NR] );
+            for( BlasInt j=nr; j<NR; ++j )
+                panel[j+l*NR] = TypeTraits<Accum>::Zero();
+        }
+    }
+}
+
+// AB := APanel BPanel for an MR x kc and a kc x NR micro-panel
+template<BlasInt MR,BlasInt NR,typename Accum>
+void MicroKernel
+( BlasInt kc, const Accum* APanel, const Accum* BPanel, Accum* AB )
+{
+    for( BlasInt i=0; i<MR*NR; ++i )
+        AB[i] = TypeTraits<Accum>::Zero();
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const Accum* a = &APanel[l*MR];
+        const Accum* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            EL_SIMD
+            for( BlasInt i=0; i<MR; ++i )
+                AB[i+j*MR] += a[i]*b[j];
+        }
+    }
+}
+
+template<typename T>
+void AddTo( T& gamma, const T& update ) { gamma += update; }
+#ifdef HYDROGEN_HAVE_HALF
+inline void AddTo( cpu_half_type& gamma, const float& update )
+{ gamma = cpu_half_type(float(gamma)+update); }
+#endif // HYDROGEN_HAVE_HALF
+
+// C := alpha op(A) op(B) + C
+//
+// When T is accumulated in a wider type (e.g., half in float), each NC-column
+// panel of C is accumulated in that type over all of the KC blocks and then
+// rounded to T once, rather than once per KC block.
+template<typename T>
+void PackedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    typedef typename Accumulator<T>::type Accum;
+    const BlasInt MR = Blocking<T>::MR;
+    const BlasInt NR = Blocking<T>::NR;
+    const BlasInt MC = Blocking<T>::MC;
+    const BlasInt KC = Blocking<T>::KC;
+    const BlasInt NC = Blocking<T>::NC;
+    const Accum alphaAccum = Accum(alpha);
+    const bool roundOnce = !std::is_same<Accum,T>::value;
+
+    const BlasInt mcMax = Min(MC,m);
+    const BlasInt ncMax = Min(NC,n);
+    const BlasInt kcMax = Min(KC,k);
+    vector<Accum> BPack(((ncMax+NR-1)/NR)*NR*kcMax);
+
+    // Each thread packs its blocks of op(A) into its own slice of APacks
+#ifdef EL_HYBRID
+# if defined(HYDROGEN_HAVE_OMP_TASKLOOP)
+    const BlasInt numThreads = omp_get_num_threads();
+# else
+    const BlasInt numThreads = omp_get_max_threads();
+# endif
+#else
+    const BlasInt numThreads = 1;
+#endif
+    const BlasInt APackSize = ((mcMax+MR-1)/MR)*MR*kcMax;
+    vector<Accum> APacks(numThreads*APackSize);
+    vector<Accum> CPanel( roundOnce ? m*ncMax : 0 );
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        if( roundOnce )
+            for( BlasInt j=0; j<nc; ++j )
+                for( BlasInt i=0; i<m; ++i )
+                    CPanel[i+j*m] = Accum(C[i+(jc+j)*CLDim]);
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+            PackB<Blocking<T>::NR>
+            ( transB, B, BLDim, pc, jc, kc, nc, BPack.data() );
+
+            // Each thread multiplies its own blocks of op(A)
+            const BlasInt numBlocks = (m+MC-1) / MC;
+            EL_PARALLEL_FOR
+            for( BlasInt block=0; block<numBlocks; ++block )
+            {
+                const BlasInt ic = block*MC;
+                const BlasInt mc = Min(MC,m-ic);
+#ifdef EL_HYBRID
+                Accum* APack = &APacks[omp_get_thread_num()*APackSize];
+#else
+                Accum* APack = APacks.data();
+#endif
+                PackA<Blocking<T>::MR>
+                ( transA, A, ALDim, ic, pc, mc, kc, APack );
+
+                Accum AB[Blocking<T>::MR*Blocking<T>::NR];
+                for( BlasInt jr=0; jr<nc; jr+=NR )
+                {
+                    const BlasInt nr = Min(NR,nc-jr);
+                    for( BlasInt ir=0; ir<mc; ir+=MR )
+                    {
+                        const BlasInt mr = Min(MR,mc-ir);
+                        MicroKernel<Blocking<T>::MR,Blocking<T>::NR>
+                        ( kc, &APack[ir*kc], &BPack[jr*kc], AB );
+                        for( BlasInt j=0; j<nr; ++j )
+                        {
+                            if( roundOnce )
+                            {
+                                Accum* CCol = &CPanel[(ic+ir)+(jr+j)*m];
+                                for( BlasInt i=0; i<mr; ++i )
+                                    CCol[i] += alphaAccum*AB[i+j*MR];
+                            }
+                            else
+                            {
+                                T* CCol = &C[(ic+ir)+(jc+jr+j)*CLDim];
+                                for( BlasInt i=0; i<mr; ++i )
+                                {
+                                    AB[i+j*MR] *= alphaAccum;
+                                    AddTo( CCol[i], AB[i+j*MR] );
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        if( roundOnce )
+            for( BlasInt j=0; j<nc; ++j )
+                for( BlasInt i=0; i<m; ++i )
+                    C[i+(jc+j)*CLDim] = T(CPanel[i+j*m]);
+    }
+}
+
+} // namespace gemm
+} // namespace blas
+} // namespace El
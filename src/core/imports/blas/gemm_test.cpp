@@ -0,0 +1,121 @@
+// MUST include this
+#include <catch2/catch.hpp>
+
+// File being tested
+#include <El.hpp>
+
+#include <vector>
+
+using namespace El;
+
+namespace
+{
+
+// op(X)(i,j) for a column-major matrix with leading dimension ldim
+Int OpEntry(char trans, std::vector<Int> const& X, Int ldim, Int i, Int j)
+{
+    return trans == 'N' ? X[i+j*ldim] : X[j+i*ldim];
+}
+
+void CheckGemm(char transA, char transB, Int m, Int n, Int k)
+{
+    const Int alpha = 3, beta = -2;
+    const Int ALDim = (transA == 'N' ? m : k) + 1;
+    const Int BLDim = (transB == 'N' ? k : n) + 2;
+    const Int CLDim = m + 3;
+    std::vector<Int> A(ALDim*(transA == 'N' ? k : m)),
+        B(BLDim*(transB == 'N' ? n : k)), C(CLDim*n);
+    for (size_t i=0; i<A.size(); ++i)
+        A[i] = Int(i % 7) - 3;
+    for (size_t i=0; i<B.size(); ++i)
+        B[i] = Int(i % 5) - 2;
+    for (size_t i=0; i<C.size(); ++i)
+        C[i] = Int(i % 3);
+
+    std::vector<Int> CRef(C);
+    for (Int j=0; j<n; ++j)
+        for (Int i=0; i<m; ++i)
+        {
+            Int gamma = 0;
+            for (Int l=0; l<k; ++l)
+                gamma += OpEntry(transA, A, ALDim, i, l)
+                       * OpEntry(transB, B, BLDim, l, j);
+            CRef[i+j*CLDim] = alpha*gamma + beta*CRef[i+j*CLDim];
+        }
+
+    blas::Gemm(transA, transB, m, n, k,
+               alpha, A.data(), ALDim, B.data(), BLDim,
+               beta, C.data(), CLDim);
+    for (Int j=0; j<n; ++j)
+        for (Int i=0; i<m; ++i)
+            REQUIRE(C[i+j*CLDim] == CRef[i+j*CLDim]);
+}
+
+#ifdef HYDROGEN_HAVE_HALF
+// Every partial sum of these products is exact in float, so accumulating all
+// of the KC blocks in float before rounding must give the correctly rounded
+// result.
+void CheckHalfGemm(Int m, Int n, Int k)
+{
+    std::vector<cpu_half_type> A(m*k), B(k*n), C(m*n);
+    std::vector<float> CRef(m*n);
+    for (Int j=0; j<n; ++j)
+        for (Int i=0; i<m; ++i)
+        {
+            float gamma = 0.25f*float(i % 3);
+            for (Int l=0; l<k; ++l)
+                gamma += (float((i+l) % 7) + 1)/4 * (float((l+j) % 5) + 1)/8;
+            C[i+j*m] = cpu_half_type(0.25f*float(i % 3));
+            CRef[i+j*m] = gamma;
+        }
+    for (Int l=0; l<k; ++l)
+    {
+        for (Int i=0; i<m; ++i)
+            A[i+l*m] = cpu_half_type((float((i+l) % 7) + 1)/4);
+        for (Int j=0; j<n; ++j)
+            B[l+j*k] = cpu_half_type((float((l+j) % 5) + 1)/8);
+    }
+
+    blas::Gemm('N', 'N', m, n, k,
+               cpu_half_type(1), A.data(), m, B.data(), k,
+               cpu_half_type(1), C.data(), m);
+    for (Int j=0; j<n; ++j)
+        for (Int i=0; i<m; ++i)
+            REQUIRE(float(C[i+j*m]) == float(cpu_half_type(CRef[i+j*m])));
+}
+#endif // HYDROGEN_HAVE_HALF
+
+}// namespace <anon>
+
+TEST_CASE("Testing the generic packed Gemm","[blas][gemm]")
+{
+    SECTION("Small and odd shapes match the reference")
+    {
+        for (char transA : {'N', 'T', 'C'})
+            for (char transB : {'N', 'T', 'C'})
+            {
+                CheckGemm(transA, transB, 1, 1, 1);
+                CheckGemm(transA, transB, 7, 5, 3);
+                CheckGemm(transA, transB, 13, 2, 9);
+            }
+    }
+
+    SECTION("Shapes spanning several cache blocks match the reference")
+    {
+        CheckGemm('N', 'N', 211, 37, 300);
+        CheckGemm('T', 'N', 130, 41, 517);
+        CheckGemm('N', 'T', 97, 2100, 11);
+    }
+
+    SECTION("An empty summation only scales C")
+    {
+        CheckGemm('N', 'N', 6, 4, 0);
+    }
+
+#ifdef HYDROGEN_HAVE_HALF
+    SECTION("Half-precision products are rounded once over all KC blocks")
+    {
+        CheckHalfGemm(19, 11, 1000);
+    }
+#endif // HYDROGEN_HAVE_HALF
+}
@@ -1,6 +1,11 @@
 #include "hydrogen/device/gpu/CUB.hpp"
+#include "hydrogen/device/gpu/GPURuntime.hpp"
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_set>
 
 namespace hydrogen
 {
@@ -52,6 +57,46 @@ bool get_debug() noexcept
 
 /** Singleton instance of CUB memory pool. */
 std::unique_ptr<cub_impl::CachingDeviceAllocator> memoryPool_;
+
+/** Counters that CUB does not track itself for one device. */
+struct DeviceStatistics
+{
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> cache_hits{0};
+    std::atomic<size_t> peak_bytes_live{0};
+    /** Guards freed. */
+    std::mutex mutex;
+    /** Blocks handed back to CUB through Free() and not reallocated since.
+     *  CUB releases a freed block that does not fit under its cache limit,
+     *  so a fresh allocation that reuses such an address is also counted
+     *  as a hit. */
+    std::unordered_set<void*> freed;
+};
+
+/** Guards the creation of per-device counters. */
+std::mutex devicesMutex_;
+/** Counters keyed on the device. */
+std::map<int, std::unique_ptr<DeviceStatistics>> devices_;
+
+DeviceStatistics& device_statistics(int device)
+{
+    std::lock_guard<std::mutex> lock(devicesMutex_);
+    auto& stats = devices_[device];
+    if (!stats)
+        stats.reset(new DeviceStatistics);
+    return *stats;
+}
+
+int current_device()
+{
+    int device = 0;
+#ifdef HYDROGEN_HAVE_CUDA
+    H_CHECK_CUDA(cudaGetDevice(&device));
+#elif defined HYDROGEN_HAVE_ROCM
+    H_CHECK_HIP(hipGetDevice(&device));
+#endif
+    return device;
+}
 } // namespace <anon>
 
 cub_impl::CachingDeviceAllocator& MemoryPool()
@@ -69,7 +114,79 @@ cub_impl::CachingDeviceAllocator& MemoryPool()
 }
 
 void DestroyMemoryPool()
-{ memoryPool_.reset(); }
+{
+    memoryPool_.reset();
+    std::lock_guard<std::mutex> lock(devicesMutex_);
+    devices_.clear();
+}
+
+ErrorType Allocate(void** ptr, size_t bytes, StreamType stream)
+{
+    auto& pool = MemoryPool();
+    int const device = current_device();
+    auto const status = pool.DeviceAllocate(ptr, bytes, stream);
+    auto& stats = device_statistics(device);
+    ++stats.allocations;
+    {
+        std::lock_guard<std::mutex> lock(stats.mutex);
+        if (stats.freed.erase(*ptr))
+            ++stats.cache_hits;
+    }
+
+    // CUB's byte counts are only consistent under its own lock.
+    size_t live;
+    {
+        std::lock_guard<decltype(pool.mutex)> lock(pool.mutex);
+        live = pool.cached_bytes[device].live;
+    }
+    size_t peak = stats.peak_bytes_live.load();
+    while (live > peak
+           && !stats.peak_bytes_live.compare_exchange_weak(peak, live)) {}
+    return status;
+}
+
+ErrorType Free(void* ptr)
+{
+    auto& stats = device_statistics(current_device());
+    {
+        std::lock_guard<std::mutex> lock(stats.mutex);
+        stats.freed.insert(ptr);
+    }
+    return MemoryPool().DeviceFree(ptr);
+}
+
+MemoryPoolStatistics GetMemoryPoolStatistics()
+{
+    auto& pool = MemoryPool();
+    int const device = current_device();
+    auto& device_stats = device_statistics(device);
+    MemoryPoolStatistics stats;
+    stats.allocations = device_stats.allocations.load();
+    stats.cache_hits = device_stats.cache_hits.load();
+    stats.peak_bytes_live = device_stats.peak_bytes_live.load();
+    std::lock_guard<decltype(pool.mutex)> lock(pool.mutex);
+    stats.bytes_live = pool.cached_bytes[device].live;
+    stats.bytes_cached = pool.cached_bytes[device].free;
+    stats.max_bytes_cached = pool.max_cached_bytes;
+    return stats;
+}
+
+void PrintMemoryPoolStatistics(std::ostream& os)
+{
+    auto const stats = GetMemoryPoolStatistics();
+    os << "CUB device memory pool:\n"
+       << "  live bytes:   " << stats.bytes_live
+       << " (peak " << stats.peak_bytes_live << ")\n"
+       << "  cached bytes: " << stats.bytes_cached
+       << " (limit " << stats.max_bytes_cached << ")\n"
+       << "  allocations:  " << stats.allocations
+       << " (" << stats.cache_hits << " from cache)\n";
+}
+
+void SetMaxCachedBytes(size_t bytes)
+{
+    MemoryPool().SetMaxCachedBytes(bytes);
+}
 
 } // namespace CUBMemoryPool
 } // namespace hydrogen
@@ -154,6 +154,8 @@ void EL_BLAS(zgemmt)
         dcomplex* C, const BlasInt* CLDim );
 #endif
 
+int mkl_set_num_threads_local( int nt );
+
 } // extern "C"
 
 namespace El {
@@ -458,6 +460,9 @@ void Trrk
 }
 #endif
 
+int SetNumThreadsLocal( int numThreads )
+{ return mkl_set_num_threads_local( numThreads ); }
+
 } // namespace mkl
 } // namespace El
 
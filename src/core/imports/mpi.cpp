@@ -236,6 +236,14 @@ EL_NO_RELEASE_EXCEPT
     EL_CHECK_MPI_CALL( MPI_Comm_set_errhandler( comm.GetMPIComm(), errorHandler ) );
 }
 
+void SetName( Comm const& comm, std::string const& name ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE;
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_set_name(
+            comm.GetMPIComm(), const_cast<char*>(name.c_str())));
+}
+
 // Cartesian communicator routines
 // ===============================
 
@@ -594,6 +602,8 @@ void TaggedSend(const Real* buf, int count, int to, int tag, Comm const& comm,
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "Send", comm, [&] { return sizeof(*buf)*count; });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(buf, count, syncInfo);
@@ -614,6 +624,8 @@ void TaggedSend(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "Send", comm, [&] { return sizeof(*buf)*count; });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(buf, count, syncInfo);
@@ -639,6 +651,8 @@ void TaggedSend( const T* buf, int count, int to, int tag, Comm const& comm,
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "Send", comm, [&] { return sizeof(*buf)*count; });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(buf, count, syncInfo);
@@ -863,6 +877,8 @@ void TaggedRecv( Real* buf, int count, int from, int tag, Comm const& comm,
                  SyncInfo<D> const& syncInfo ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "Recv", comm, [&] { return sizeof(*buf)*count; });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_RECV_BUFFER(buf, count, syncInfo);
@@ -882,6 +898,8 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm const& c
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "Recv", comm, [&] { return sizeof(*buf)*count; });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_RECV_BUFFER(buf, count, syncInfo);
@@ -910,6 +928,8 @@ void TaggedRecv( T* buf, int count, int from, int tag, Comm const& comm,
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "Recv", comm, [&] { return sizeof(*buf)*count; });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_RECV_BUFFER(buf, count, syncInfo);
@@ -1021,6 +1041,8 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "SendRecv", comm, [&] { return sizeof(*rbuf)*(size_t(sc) + rc); });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, sc, syncInfo);
@@ -1046,6 +1068,8 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "SendRecv", comm, [&] { return sizeof(*rbuf)*(size_t(sc) + rc); });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, sc, syncInfo);
@@ -1080,6 +1104,8 @@ void TaggedSendRecv(
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "SendRecv", comm, [&] { return sizeof(*rbuf)*(size_t(sc) + rc); });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, sc, syncInfo);
@@ -1126,6 +1152,8 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "SendRecv", comm, [&] { return 2*sizeof(*buf)*count; });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -1148,6 +1176,8 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "SendRecv", comm, [&] { return 2*sizeof(*buf)*count; });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -1178,6 +1208,8 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "SendRecv", comm, [&] { return 2*sizeof(*buf)*count; });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -1318,6 +1350,102 @@ void IGather
         &request.backend ) );
 }
 
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE;
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.GetMPIComm(),
+        &request.backend ) );
+}
+
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm const& comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE;
+#ifdef EL_AVOID_COMPLEX_MPI
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.GetMPIComm(), &request.backend ) );
+#else
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.GetMPIComm(), &request.backend ) );
+#endif
+}
+
+template <typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm const& comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE;
+    AllGather( sbuf, sc, rbuf, rc, comm, SyncInfo<Device::CPU>{} );
+    request.backend = MPI_REQUEST_NULL;
+}
+
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE;
+    EL_CHECK_MPI_CALL
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Real*>(sbuf), rbuf, rc, TypeMap<Real>(),
+        NativeOp<Real>(SUM), comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Comm const& comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE;
+#ifdef EL_AVOID_COMPLEX_MPI
+    EL_CHECK_MPI_CALL
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*rc, TypeMap<Real>(),
+        NativeOp<Real>(SUM), comm.GetMPIComm(), &request.backend ) );
+#else
+    EL_CHECK_MPI_CALL
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, rc, TypeMap<Complex<Real>>(),
+        NativeOp<Complex<Real>>(SUM), comm.GetMPIComm(), &request.backend ) );
+#endif
+}
+
+template <typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm const& comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE;
+    ReduceScatter( sbuf, rbuf, rc, comm, SyncInfo<Device::CPU>{} );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template <typename Real, Device D,
           typename/*=EnableIf<IsPacked<Real>>*/>
 void Gather(
@@ -1327,6 +1455,13 @@ void Gather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "GatherV", comm, [&]
+        {
+            const bool isRoot = (Rank(comm) == root);
+            return sizeof(*rbuf)*
+              (sc + (isRoot ? stats::TotalCount(rcs, Size(comm)) : 0));
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = Rank(comm);
@@ -1357,6 +1492,13 @@ void Gather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "GatherV", comm, [&]
+        {
+            const bool isRoot = (Rank(comm) == root);
+            return sizeof(*rbuf)*
+              (sc + (isRoot ? stats::TotalCount(rcs, Size(comm)) : 0));
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = Rank(comm);
@@ -1409,6 +1551,13 @@ void Gather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "GatherV", comm, [&]
+        {
+            const bool isRoot = (Rank(comm) == root);
+            return sizeof(*rbuf)*
+              (sc + (isRoot ? stats::TotalCount(rcs, Size(comm)) : 0));
+        });
 
     Synchronize(syncInfo);
 
@@ -1447,6 +1596,11 @@ void AllGather(
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "AllGatherV", comm, [&]
+        {
+            return sizeof(*rbuf)*(sc + stats::TotalCount(rcs, Size(comm)));
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1493,6 +1647,11 @@ void AllGather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "AllGatherV", comm, [&]
+        {
+            return sizeof(*rbuf)*(sc + stats::TotalCount(rcs, Size(comm)));
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1556,6 +1715,11 @@ void AllGather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "AllGatherV", comm, [&]
+        {
+            return sizeof(*rbuf)*(sc + stats::TotalCount(rcs, Size(comm)));
+        });
 
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1587,6 +1751,12 @@ void Scatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "Scatter", comm, [&]
+        {
+            const int sends = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*buf)*(rc + size_t(sc)*sends);
+        });
 
     auto const commRank = Rank( comm );
 
@@ -1627,6 +1797,12 @@ void Scatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "Scatter", comm, [&]
+        {
+            const int sends = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*buf)*(rc + size_t(sc)*sends);
+        });
 
     auto const commRank = Rank( comm );
 
@@ -1681,6 +1857,12 @@ void Scatter(T* buf, int sc, int rc, int root, Comm const& comm,
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "Scatter", comm, [&]
+        {
+            const int sends = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*buf)*(rc + size_t(sc)*sends);
+        });
     auto const commSize = mpi::Size(comm);
     auto const commRank = Rank( comm );
     auto const totalSend =
@@ -1719,6 +1901,13 @@ void AllToAll(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "AllToAllV", comm, [&]
+        {
+            const int commSize = Size(comm);
+            return sizeof(*rbuf)*(stats::TotalCount(scs, commSize) +
+                                  stats::TotalCount(rcs, commSize));
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1748,6 +1937,13 @@ void AllToAll(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "AllToAllV", comm, [&]
+        {
+            const int commSize = Size(comm);
+            return sizeof(*rbuf)*(stats::TotalCount(scs, commSize) +
+                                  stats::TotalCount(rcs, commSize));
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1797,6 +1993,13 @@ void AllToAll(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "AllToAllV", comm, [&]
+        {
+            const int commSize = Size(comm);
+            return sizeof(*rbuf)*(stats::TotalCount(scs, commSize) +
+                                  stats::TotalCount(rcs, commSize));
+        });
 
     auto const commSize = Size(comm);
     auto const totalSend =
@@ -1857,6 +2060,12 @@ void ReduceScatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "ReduceScatterV", comm, [&]
+        {
+            return sizeof(*rbuf)*
+              (stats::TotalCount(rcs, Size(comm)) + rcs[Rank(comm)]);
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = mpi::Rank(comm);
@@ -1883,6 +2092,12 @@ void ReduceScatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "ReduceScatterV", comm, [&]
+        {
+            return sizeof(*rbuf)*
+              (stats::TotalCount(rcs, Size(comm)) + rcs[Rank(comm)]);
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = mpi::Rank(comm);
@@ -1933,6 +2148,12 @@ void ReduceScatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "ReduceScatterV", comm, [&]
+        {
+            return sizeof(*rbuf)*
+              (stats::TotalCount(rcs, Size(comm)) + rcs[Rank(comm)]);
+        });
 
     Synchronize(syncInfo);
 
@@ -2335,6 +2556,12 @@ EL_NO_RELEASE_EXCEPT
         const T* sbuf, int sc,                                          \
         T* rbuf, int rc,                                                \
         int root, Comm const& comm, Request<T>& request);                      \
+    template void IAllGather(                                           \
+        const T* sbuf, int sc,                                          \
+        T* rbuf, int rc, Comm const& comm, Request<T>& request);        \
+    template void IReduceScatter(                                       \
+        const T* sbuf, T* rbuf, int rc, Comm const& comm,               \
+        Request<T>& request);                                           \
     MPI_PROTO_DEVICELESS_COMMON(T)
 
 #define MPI_PROTO_DEVICELESS_COMPLEX(T)                                 \
@@ -2357,6 +2584,13 @@ EL_NO_RELEASE_EXCEPT
         const Complex<T>* sbuf, int sc,                                 \
         Complex<T>* rbuf, int rc,                                       \
         int root, Comm const& comm, Request<Complex<T>>& request);             \
+    template void IAllGather<T>(                                        \
+        const Complex<T>* sbuf, int sc,                                 \
+        Complex<T>* rbuf, int rc, Comm const& comm,                     \
+        Request<Complex<T>>& request);                                  \
+    template void IReduceScatter<T>(                                    \
+        const Complex<T>* sbuf, Complex<T>* rbuf, int rc, Comm const& comm, \
+        Request<Complex<T>>& request);                                  \
     MPI_PROTO_DEVICELESS_COMMON(Complex<T>)
 
 #define MPI_PROTO_COMMON_DEV(T,D)               \
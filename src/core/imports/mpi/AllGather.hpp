@@ -13,6 +13,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE;
+    stats::Scope commStats(
+        "AllGather", comm,
+        [&] { return sizeof(*rbuf)*(sc + size_t(rc)*Size(comm)); });
     using Backend = BestBackend<T,D,Collective::ALLGATHER>;
     Al::Allgather<Backend>(
         sbuf, rbuf, sc, comm.template GetComm<Backend>(syncInfo));
@@ -25,6 +28,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllGather", comm,
+        [&] { return sizeof(*rbuf)*(sc + size_t(rc)*Size(comm)); });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -60,6 +66,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllGather", comm,
+        [&] { return sizeof(*rbuf)*(sc + size_t(rc)*Size(comm)); });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -100,6 +109,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllGather", comm,
+        [&] { return sizeof(*rbuf)*(sc + size_t(rc)*Size(comm)); });
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
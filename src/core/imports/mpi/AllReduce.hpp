@@ -13,6 +13,8 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllReduce", comm, [&] { return 2*sizeof(*rbuf)*count; });
     using Backend = BestBackend<T,D,Collective::ALLREDUCE>;
 
     if (count == 0)
@@ -29,6 +31,8 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllReduce", comm, [&] { return 2*sizeof(*rbuf)*count; });
     if (count == 0)
         return;
 
@@ -50,6 +54,8 @@ void AllReduce(Complex<T> const* sbuf, Complex<T>* rbuf, int count, Op op,
                Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllReduce", comm, [&] { return 2*sizeof(*rbuf)*count; });
 
     if (count == 0)
         return;
@@ -89,6 +95,8 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllReduce", comm, [&] { return 2*sizeof(*rbuf)*count; });
     if (count == 0)
         return;
 
@@ -127,6 +135,8 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllReduce", comm, [&] { return 2*sizeof(*buf)*count; });
     using Backend = BestBackend<T,D,Collective::ALLREDUCE>;
 
     if (count == 0)
@@ -143,6 +153,8 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllReduce", comm, [&] { return 2*sizeof(*buf)*count; });
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -163,6 +175,8 @@ void AllReduce(Complex<T>* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllReduce", comm, [&] { return 2*sizeof(*buf)*count; });
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -201,6 +215,8 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllReduce", comm, [&] { return 2*sizeof(*buf)*count; });
     if (count == 0)
         return;
 
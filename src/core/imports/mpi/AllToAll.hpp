@@ -12,6 +12,8 @@ void AllToAll(T const* sbuf, int /*sc*/, T* rbuf, int rc, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllToAll", comm, [&] { return 2*sizeof(*rbuf)*rc*Size(comm); });
     if (rc == 0)
         return;
 
@@ -26,6 +28,8 @@ void AllToAll(T const* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllToAll", comm, [&] { return sizeof(*rbuf)*(sc + rc)*Size(comm); });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -47,6 +51,8 @@ void AllToAll(Complex<T> const* sbuf,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllToAll", comm, [&] { return sizeof(*rbuf)*(sc + rc)*Size(comm); });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -79,6 +85,8 @@ void AllToAll(T const* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "AllToAll", comm, [&] { return sizeof(*rbuf)*(sc + rc)*Size(comm); });
 
     const int commSize = mpi::Size(comm);
     const int totalSend = sc*commSize;
@@ -14,6 +14,8 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Broadcast", comm, [&] { return sizeof(*buffer)*count; });
 
     using Backend = BestBackend<T,D,Collective::BROADCAST>;
     Al::Bcast<Backend>(
@@ -26,6 +28,8 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Broadcast", comm, [&] { return sizeof(*buffer)*count; });
     if (Size(comm) == 1 || count == 0)
         return;
 
@@ -49,6 +53,8 @@ void Broadcast(Complex<T>* buffer, int count, int root, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Broadcast", comm, [&] { return sizeof(*buffer)*count; });
     if (Size(comm) == 1 || count == 0)
         return;
 
@@ -76,6 +82,8 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Broadcast", comm, [&] { return sizeof(*buffer)*count; });
     if (Size(comm) == 1 || count == 0)
         return;
 
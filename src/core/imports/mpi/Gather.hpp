@@ -13,6 +13,12 @@ void Gather(
     T* rbuf, int rc, int root, Comm const& comm, SyncInfo<D> const& syncInfo )
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Gather", comm, [&]
+        {
+            const int recvs = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*rbuf)*(sc + size_t(rc)*recvs);
+        });
 
     using Backend = BestBackend<T,D,Collective::GATHER>;
     Al::Gather<Backend>(
@@ -27,6 +33,12 @@ void Gather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Gather", comm, [&]
+        {
+            const int recvs = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*rbuf)*(sc + size_t(rc)*recvs);
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const rank = mpi::Rank(comm);
@@ -52,6 +64,12 @@ void Gather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Gather", comm, [&]
+        {
+            const int recvs = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*rbuf)*(sc + size_t(rc)*recvs);
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const rank = mpi::Rank(comm);
@@ -85,6 +103,12 @@ void Gather(
     T* rbuf, int rc, int root, Comm const& comm, SyncInfo<D> const& syncInfo )
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Gather", comm, [&]
+        {
+            const int recvs = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*rbuf)*(sc + size_t(rc)*recvs);
+        });
 
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
@@ -12,6 +12,9 @@ void Reduce(T const* sbuf, T* rbuf, int count, Op op,
             int root, Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Reduce", comm,
+        [&] { return sizeof(*rbuf)*count*(Rank(comm) == root ? 2 : 1); });
 
     using Backend = BestBackend<T,D,Collective::REDUCE>;
     Al::Reduce<Backend>(
@@ -25,6 +28,9 @@ void Reduce(T const* sbuf, T* rbuf, int count, Op op,
             int root, Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Reduce", comm,
+        [&] { return sizeof(*rbuf)*count*(Rank(comm) == root ? 2 : 1); });
     if (count == 0)
         return;
 
@@ -49,6 +55,9 @@ void Reduce(const Complex<T>* sbuf, Complex<T>* rbuf, int count, Op op,
             int root, Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Reduce", comm,
+        [&] { return sizeof(*rbuf)*count*(Rank(comm) == root ? 2 : 1); });
     if (count == 0)
         return;
 
@@ -90,6 +99,9 @@ void Reduce(T const* sbuf, T* rbuf, int count, Op op,
             int root, Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Reduce", comm,
+        [&] { return sizeof(*rbuf)*count*(Rank(comm) == root ? 2 : 1); });
     if (count == 0)
         return;
 
@@ -155,6 +167,9 @@ void Reduce(T* buf, int count, Op op,
             int root, Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Reduce", comm,
+        [&] { return sizeof(*buf)*count*(Rank(comm) == root ? 2 : 1); });
 
     using Backend = BestBackend<T,D,Collective::REDUCE>;
     Al::Reduce<Backend>(
@@ -168,6 +183,9 @@ void Reduce(T* buf, int count, Op op, int root, Comm const& comm,
             SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Reduce", comm,
+        [&] { return sizeof(*buf)*count*(Rank(comm) == root ? 2 : 1); });
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -198,6 +216,9 @@ void Reduce(Complex<T>* buf, int count, Op op, int root, Comm const& comm,
             SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Reduce", comm,
+        [&] { return sizeof(*buf)*count*(Rank(comm) == root ? 2 : 1); });
     if (Size(comm) == 1 || count == 0)
         return;
 
@@ -264,6 +285,9 @@ void Reduce(T* buf, int count, Op op, int root, Comm const& comm,
             SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Reduce", comm,
+        [&] { return sizeof(*buf)*count*(Rank(comm) == root ? 2 : 1); });
     if (count == 0)
         return;
 
@@ -41,6 +41,9 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "ReduceScatter", comm,
+        [&] { return sizeof(*rbuf)*count*(Size(comm) + 1); });
     if (count == 0)
         return;
     if (comm.Size() == 1)
@@ -58,6 +61,9 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "ReduceScatter", comm,
+        [&] { return sizeof(*rbuf)*count*(Size(comm) + 1); });
     if (count == 0)
         return;
 
@@ -80,6 +86,9 @@ void ReduceScatter(Complex<T> const* sbuf, Complex<T>* rbuf,
                    int count, Op op, Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "ReduceScatter", comm,
+        [&] { return sizeof(*rbuf)*count*(Size(comm) + 1); });
     if (count == 0)
         return;
 
@@ -110,6 +119,9 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "ReduceScatter", comm,
+        [&] { return sizeof(*rbuf)*count*(Size(comm) + 1); });
     if (count == 0)
         return;
 
@@ -154,6 +166,9 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "ReduceScatter", comm,
+        [&] { return sizeof(*buf)*count*(Size(comm) + 1); });
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -169,6 +184,9 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "ReduceScatter", comm,
+        [&] { return sizeof(*buf)*count*(Size(comm) + 1); });
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -191,6 +209,9 @@ void ReduceScatter(Complex<T>* buf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "ReduceScatter", comm,
+        [&] { return sizeof(*buf)*count*(Size(comm) + 1); });
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -221,6 +242,9 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "ReduceScatter", comm,
+        [&] { return sizeof(*buf)*count*(Size(comm) + 1); });
     if (count == 0)
         return;
     const int commSize = mpi::Size(comm);
@@ -13,6 +13,12 @@ void Scatter(
     T* rbuf, int rc, int root, Comm const& comm, SyncInfo<D> const& syncInfo )
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Scatter", comm, [&]
+        {
+            const int sends = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*rbuf)*(rc + size_t(sc)*sends);
+        });
 
     using Backend = BestBackend<T,D,Collective::GATHER>;
     Al::Scatter<Backend>(sbuf, rbuf, sc, root,
@@ -27,6 +33,13 @@ void Scatter(
     T* rbuf, int rc, int root, Comm const& comm,
     SyncInfo<D> const& syncInfo)
 {
+    stats::Scope commStats(
+        "Scatter", comm, [&]
+        {
+            const int sends = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*rbuf)*(rc + size_t(sc)*sends);
+        });
+
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
     auto const commRank = Rank(comm);
@@ -50,6 +63,12 @@ void Scatter(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Scatter", comm, [&]
+        {
+            const int sends = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*rbuf)*(rc + size_t(sc)*sends);
+        });
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -82,6 +101,12 @@ void Scatter(
     T* rbuf, int rc, int root, Comm const& comm, SyncInfo<D> const& syncInfo )
 {
     EL_DEBUG_CSE
+    stats::Scope commStats(
+        "Scatter", comm, [&]
+        {
+            const int sends = (Rank(comm) == root ? Size(comm) : 0);
+            return sizeof(*rbuf)*(rc + size_t(sc)*sends);
+        });
 
     auto const commSize = Size(comm);
     auto const commRank = Rank(comm);
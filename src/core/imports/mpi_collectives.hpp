@@ -14,6 +14,7 @@
 */
 #include <El-lite.hpp>
 #include "mpi_utils.hpp"
+#include "mpi_stats.hpp"
 
 #include <El/core/imports/aluminum.hpp>
 
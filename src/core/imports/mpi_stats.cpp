@@ -0,0 +1,375 @@
+#include <El.hpp>
+#include <El/core/Profiling.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+
+#include "mpi_stats.hpp"
+
+namespace El
+{
+
+namespace
+{
+
+// Calls that moved 2^(num_size_bins-2) bytes or more share the last bin
+constexpr size_t num_size_bins = 48;
+
+// The region, operation, communicator name and communicator size
+using StatsKey = std::tuple<std::string, std::string, std::string, int>;
+
+struct Counters
+{
+    std::uint64_t calls = 0;
+    std::uint64_t bytes = 0;
+    double time = 0.;// seconds
+    std::uint64_t histogram[num_size_bins] = {};
+};
+
+// The statistics of a single thread. Only the owning thread writes to
+// them, so no synchronization is needed while recording.
+struct ThreadStats
+{
+    // The regions that are currently open on this thread; regions that
+    // began while the statistics were disabled are empty strings
+    std::vector<std::string> open_regions;
+    std::map<StatsKey, Counters> counters;
+};
+
+std::atomic<bool> stats_enabled{false};
+bool report_at_finalize = false;
+
+std::mutex stats_mutex;
+std::vector<std::unique_ptr<ThreadStats>> thread_stats;
+
+thread_local ThreadStats* local_stats = nullptr;
+
+ThreadStats* GetLocalStats()
+{
+    if (!local_stats)
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex);
+        thread_stats.emplace_back(new ThreadStats);
+        local_stats = thread_stats.back().get();
+    }
+    return local_stats;
+}
+
+size_t SizeBin(size_t bytes) noexcept
+{
+    size_t bin = 0;
+    while (bytes != 0 && bin+1 < num_size_bins)
+    {
+        bytes >>= 1;
+        ++bin;
+    }
+    return bin;
+}
+
+// The smallest number of bytes that falls into the given bin
+std::string BinLabel(size_t bin)
+{
+    if (bin == 0)
+        return "0";
+    const std::uint64_t bytes = std::uint64_t(1) << (bin-1);
+    const char* units[] = { "", "K", "M", "G", "T" };
+    size_t unit = 0;
+    std::uint64_t value = bytes;
+    while (value >= 1024 && unit+1 < sizeof(units)/sizeof(units[0]))
+    {
+        value /= 1024;
+        ++unit;
+    }
+    return std::to_string(value) + units[unit];
+}
+
+}// namespace <anon>
+
+void EnableCommStats() noexcept
+{
+    stats_enabled = true;
+}
+
+void DisableCommStats() noexcept
+{
+    stats_enabled = false;
+}
+
+bool CommStatsEnabled() noexcept
+{
+    return stats_enabled.load(std::memory_order_relaxed);
+}
+
+void ClearCommStats() noexcept
+{
+    std::lock_guard<std::mutex> lock(stats_mutex);
+    for (auto& ts : thread_stats)
+        ts->counters.clear();
+}
+
+std::vector<CommStats> GetCommStats()
+{
+    EL_DEBUG_CSE
+    std::map<StatsKey, Counters> merged;
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex);
+        for (auto const& ts : thread_stats)
+        {
+            for (auto const& entry : ts->counters)
+            {
+                auto& c = merged[entry.first];
+                c.calls += entry.second.calls;
+                c.bytes += entry.second.bytes;
+                c.time += entry.second.time;
+                for (size_t b=0; b<num_size_bins; ++b)
+                    c.histogram[b] += entry.second.histogram[b];
+            }
+        }
+    }
+
+    std::vector<CommStats> stats;
+    stats.reserve(merged.size());
+    for (auto const& entry : merged)
+    {
+        CommStats s;
+        std::tie(s.region, s.operation, s.comm, s.commSize) = entry.first;
+        s.calls = entry.second.calls;
+        s.bytes = entry.second.bytes;
+        s.time = entry.second.time;
+        s.sizeHistogram.assign(
+            entry.second.histogram, entry.second.histogram+num_size_bins);
+        stats.push_back(std::move(s));
+    }
+    return stats;
+}
+
+void PrintCommStatsReport(std::ostream& os)
+{
+    EL_DEBUG_CSE
+    mpi::Comm const& comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank(comm);
+    const int commSize = mpi::Size(comm);
+
+    // Serialize the local statistics as lines of text and gather them
+    std::ostringstream localStream;
+    localStream << std::setprecision(17);
+    for (auto const& s : GetCommStats())
+    {
+        localStream << s.region << '\t' << s.operation << '\t' << s.comm
+                    << '\t' << s.commSize << '\t' << s.calls << '\t'
+                    << s.bytes << '\t' << s.time;
+        for (auto const& count : s.sizeHistogram)
+            localStream << ' ' << count;
+        localStream << '\n';
+    }
+    const std::string localString = localStream.str();
+    const int localSize = int(localString.size());
+    vector<int> sizes(commSize), offsets(commSize);
+    mpi::Gather(
+        &localSize, 1, sizes.data(), 1, 0, comm, SyncInfo<Device::CPU>{});
+    int totalSize = 0;
+    for (int q=0; q<commSize; ++q)
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    vector<byte> allStrings(Max(totalSize,1));
+    mpi::Gather(
+        reinterpret_cast<const byte*>(localString.data()), localSize,
+        allStrings.data(), sizes.data(), offsets.data(), 0, comm,
+        SyncInfo<Device::CPU>{});
+    if (commRank != 0)
+        return;
+
+    struct GlobalStats
+    {
+        int ranks = 0;
+        std::uint64_t calls = 0, bytes = 0;
+        double maxTime = 0., sumTime = 0.;
+        std::vector<std::uint64_t> histogram;
+    };
+    std::map<StatsKey, GlobalStats> stats;
+    for (int q=0; q<commSize; ++q)
+    {
+        std::istringstream stream(
+            std::string(
+                reinterpret_cast<const char*>(&allStrings[offsets[q]]),
+                sizes[q]));
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            std::istringstream fields(line);
+            StatsKey key;
+            std::string commSizeString;
+            std::getline(fields, std::get<0>(key), '\t');
+            std::getline(fields, std::get<1>(key), '\t');
+            std::getline(fields, std::get<2>(key), '\t');
+            std::getline(fields, commSizeString, '\t');
+            std::get<3>(key) = std::stoi(commSizeString);
+            std::uint64_t calls, bytes;
+            double time;
+            fields >> calls >> bytes >> time;
+
+            auto& s = stats[key];
+            s.histogram.resize(num_size_bins, 0);
+            for (size_t b=0; b<num_size_bins; ++b)
+            {
+                std::uint64_t count;
+                fields >> count;
+                s.histogram[b] += count;
+            }
+            s.calls += calls;
+            s.bytes += bytes;
+            s.maxTime = Max(s.maxTime, time);
+            s.sumTime += time;
+            ++s.ranks;
+        }
+    }
+
+    // Report the most expensive operations first
+    vector<std::pair<StatsKey,GlobalStats>> sorted(stats.begin(), stats.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](std::pair<StatsKey,GlobalStats> const& a,
+                 std::pair<StatsKey,GlobalStats> const& b)
+              { return a.second.maxTime > b.second.maxTime; });
+
+    const size_t regionWidth = 32;
+    os << std::left << std::setw(regionWidth) << "Region"
+       << std::setw(16) << "Operation" << std::setw(18) << "Communicator"
+       << std::right << std::setw(6) << "Size" << std::setw(8) << "Ranks"
+       << std::setw(12) << "Calls" << std::setw(14) << "Bytes"
+       << std::setw(14) << "Time avg" << std::setw(14) << "Time max"
+       << "  Message sizes (bytes:calls)\n";
+    os << std::scientific << std::setprecision(4);
+    for (auto const& entry : sorted)
+    {
+        auto const& key = entry.first;
+        auto const& s = entry.second;
+        const std::string& region = std::get<0>(key);
+        const std::string& commName = std::get<2>(key);
+        os << std::left
+           << std::setw(regionWidth) << (region.empty() ? "-" : region)
+           << std::setw(16) << std::get<1>(key)
+           << std::setw(18) << (commName.empty() ? "-" : commName)
+           << std::right << std::setw(6) << std::get<3>(key)
+           << std::setw(8) << s.ranks << std::setw(12) << s.calls
+           << std::setw(14) << s.bytes
+           << std::setw(14) << s.sumTime/s.ranks
+           << std::setw(14) << s.maxTime << " ";
+        for (size_t b=0; b<num_size_bins; ++b)
+            if (s.histogram[b] != 0)
+                os << ' ' << BinLabel(b) << ':' << s.histogram[b];
+        os << "\n";
+    }
+    os << std::defaultfloat;
+}
+
+namespace mpi
+{
+namespace stats
+{
+
+bool Enabled() noexcept
+{
+    return CommStatsEnabled();
+}
+
+void BeginRegion(char const* desc) noexcept
+{
+    if (!Enabled())
+    {
+        // Keep the nesting of this thread's open regions consistent
+        if (local_stats)
+            local_stats->open_regions.emplace_back();
+        return;
+    }
+    try
+    {
+        GetLocalStats()->open_regions.emplace_back(desc);
+    }
+    catch (...)
+    {
+        // Give up on the statistics rather than failing the application
+        DisableCommStats();
+    }
+}
+
+void EndRegion() noexcept
+{
+    // A region that began before the statistics were first enabled was
+    // never pushed
+    ThreadStats* ts = local_stats;
+    if (ts && !ts->open_regions.empty())
+        ts->open_regions.pop_back();
+}
+
+void Scope::Record() noexcept
+{
+    const double time =
+        std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start_).count();
+    try
+    {
+        char name[MPI_MAX_OBJECT_NAME];
+        int nameLength = 0, commSize = 0;
+        MPI_Comm_get_name(comm_, name, &nameLength);
+        MPI_Comm_size(comm_, &commSize);
+
+        // Attribute the call to the innermost region whose name is known
+        auto& ts = *GetLocalStats();
+        std::string region;
+        for (auto it=ts.open_regions.rbegin(); it!=ts.open_regions.rend();
+             ++it)
+        {
+            if (!it->empty())
+            {
+                region = *it;
+                break;
+            }
+        }
+
+        auto& c = ts.counters[StatsKey(
+            std::move(region), operation_, std::string(name,nameLength),
+            commSize)];
+        ++c.calls;
+        c.bytes += bytes_;
+        c.time += time;
+        ++c.histogram[SizeBin(bytes_)];
+    }
+    catch (...)
+    {
+        DisableCommStats();
+    }
+}
+
+void Initialize()
+{
+    char const* env = std::getenv("H_COMM_STATS");
+    if (env && *env)
+    {
+        report_at_finalize = true;
+        EnableCommStats();
+    }
+}
+
+void Finalize()
+{
+    if (!report_at_finalize)
+        return;
+    DisableCommStats();
+    std::ostringstream report;
+    PrintCommStatsReport(report);
+    if (mpi::Rank(mpi::COMM_WORLD) == 0)
+        std::cout << report.str();
+    report_at_finalize = false;
+}
+
+}// namespace stats
+}// namespace mpi
+}// namespace El
@@ -0,0 +1,92 @@
+#pragma once
+#ifndef EL_IMPORTS_MPI_STATS_HPP_
+#define EL_IMPORTS_MPI_STATS_HPP_
+
+// Internal hooks of the communication statistics; see EnableCommStats in
+// El/core/Profiling.hpp for the public interface.
+
+#include <chrono>
+#include <cstddef>
+
+#include <El/core/imports/mpi.hpp>
+
+namespace El
+{
+namespace mpi
+{
+namespace stats
+{
+
+/** \brief Whether communication is currently being recorded. */
+bool Enabled() noexcept;
+
+/** \brief Track the beginning of a profiling region on the calling
+ *      thread so that communication can be attributed to it.
+ */
+void BeginRegion(char const* desc) noexcept;
+
+/** \brief Track the end of the innermost open profiling region on the
+ *      calling thread.
+ */
+void EndRegion() noexcept;
+
+/** \brief Enable the statistics if the H_COMM_STATS environment
+ *      variable is set.
+ */
+void Initialize();
+
+/** \brief Print the report requested by H_COMM_STATS.
+ *
+ *  This is collective over MPI_COMM_WORLD and must precede MPI_Finalize.
+ */
+void Finalize();
+
+/** \brief The sum of the per-process counts of a variable-size
+ *      operation.
+ */
+inline size_t TotalCount(int const* counts, int commSize) noexcept
+{
+    size_t total = 0;
+    for (int q=0; q<commSize; ++q)
+        total += counts[q];
+    return total;
+}
+
+/** \brief Record a single communication call over its lifetime.
+ *
+ *  The number of bytes is only computed, by calling the given functor,
+ *  when the statistics are enabled, so a disabled scope costs no more
+ *  than a check of a flag.
+ */
+class Scope
+{
+public:
+    template <typename BytesFunc>
+    Scope(char const* operation, Comm const& comm, BytesFunc&& bytes)
+    {
+        if (Enabled())
+        {
+            operation_ = operation;
+            comm_ = comm.GetMPIComm();
+            bytes_ = bytes();
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+    ~Scope() { if (operation_) Record(); }
+
+    Scope(Scope const&) = delete;
+    Scope& operator=(Scope const&) = delete;
+
+private:
+    void Record() noexcept;
+
+    char const* operation_ = nullptr;
+    MPI_Comm comm_;
+    size_t bytes_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}// namespace stats
+}// namespace mpi
+}// namespace El
+#endif /* EL_IMPORTS_MPI_STATS_HPP_ */
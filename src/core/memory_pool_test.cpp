@@ -0,0 +1,175 @@
+// MUST include this
+#include <catch2/catch.hpp>
+
+// File being tested
+#include <El/core/MemoryPool.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace El;
+
+TEST_CASE("Testing the host memory pool","[memory][pool]")
+{
+    MemoryPool<false> pool;
+
+    SECTION("Allocations are usable and suitably aligned")
+    {
+        for (size_t size : {1UL, 7UL, 100UL, 4096UL, 1UL<<20})
+        {
+            void* ptr = pool.Allocate(size);
+            REQUIRE(ptr != nullptr);
+            CHECK(reinterpret_cast<std::uintptr_t>(ptr)
+                  % alignof(std::max_align_t) == 0UL);
+            std::memset(ptr, 0xFF, size);
+            pool.Free(ptr);
+        }
+    }
+
+    SECTION("Freed memory is reused for requests in the same bin")
+    {
+        void* ptr = pool.Allocate(1000);
+        pool.Free(ptr);
+        void* other = pool.Allocate(999);
+        CHECK(other == ptr);
+        pool.Free(other);
+    }
+
+    SECTION("Oversized allocations bypass the bins")
+    {
+        void* ptr = pool.Allocate((1UL<<26) + 1);
+        REQUIRE(ptr != nullptr);
+        pool.Free(ptr);
+    }
+
+    SECTION("Freeing an unknown or already freed pointer is an error")
+    {
+        CHECK_THROWS(pool.Free(nullptr));
+        int foreign = 0;
+        CHECK_THROWS(pool.Free(&foreign));
+        void* ptr = pool.Allocate(64);
+        pool.Free(ptr);
+        CHECK_THROWS(pool.Free(ptr));
+        void* large = pool.Allocate((1UL<<26) + 1);
+        pool.Free(large);
+        CHECK_THROWS(pool.Free(large));
+    }
+
+    SECTION("Many threads can allocate and free concurrently")
+    {
+        auto work = [&pool]()
+        {
+            std::vector<void*> ptrs;
+            for (int iter = 0; iter < 100; ++iter)
+            {
+                for (size_t size = 8; size < 100000; size *= 3)
+                    ptrs.push_back(pool.Allocate(size));
+                for (auto& ptr : ptrs)
+                    pool.Free(ptr);
+                ptrs.clear();
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t)
+            threads.emplace_back(work);
+        for (auto& thread : threads)
+            thread.join();
+        pool.FreeAllUnused();
+    }
+
+    SECTION("Statistics track live, cached, and peak bytes")
+    {
+        void* small = pool.Allocate(1000);
+        void* large = pool.Allocate((1UL<<26) + 1);
+        auto stats = pool.GetStatistics();
+        CHECK(stats.bytes_live >= 1000UL + (1UL<<26) + 1);
+        CHECK(stats.oversize_allocations == 1UL);
+
+        pool.Free(large);
+        pool.Free(small);
+        stats = pool.GetStatistics();
+        CHECK(stats.bytes_live == 0UL);
+        CHECK(stats.bytes_cached >= 1000UL);
+        CHECK(stats.peak_bytes_live >= 1000UL + (1UL<<26) + 1);
+
+        void* reused = pool.Allocate(1000);
+        pool.Free(reused);
+        size_t hits = 0, misses = 0;
+        for (auto const& bin : pool.GetStatistics().bins)
+        {
+            hits += bin.hits;
+            misses += bin.misses;
+        }
+        CHECK(hits == 1UL);
+        CHECK(misses == 1UL);
+    }
+
+    SECTION("The cache limit releases the least recently cached memory")
+    {
+        std::vector<void*> ptrs;
+        for (size_t size = 16; size <= (1UL<<20); size *= 2)
+            ptrs.push_back(pool.Allocate(size));
+        for (auto& ptr : ptrs)
+            pool.Free(ptr);
+        CHECK(pool.GetStatistics().bytes_cached >= (1UL<<21) - 16);
+
+        pool.SetMaxCachedBytes(1UL<<20);
+        auto stats = pool.GetStatistics();
+        CHECK(stats.bytes_cached <= (1UL<<20));
+        CHECK(stats.bytes_trimmed > 0UL);
+
+        pool.Trim(0);
+        CHECK(pool.GetStatistics().bytes_cached == 0UL);
+    }
+}
+
+TEST_CASE("Testing the eviction order of the memory pool","[memory][pool]")
+{
+    // Power-of-2 bins and magazines of two, so every third free of a bin
+    // moves its oldest allocation to the depot.
+    MemoryPool<false> pool(2.0f, 1, 1UL<<20, 2);
+    auto cached_in = [&pool](size_t size)
+    {
+        for (auto const& bin : pool.GetStatistics().bins)
+            if (bin.size == size)
+                return bin.cached;
+        return size_t(-1);
+    };
+
+    std::vector<size_t> const sizes = { 1UL<<10, 1UL<<12, 1UL<<14 };
+    size_t total = 0;
+    for (auto const& size : sizes)
+    {
+        void* ptrs[3];
+        for (auto& ptr : ptrs)
+            ptr = pool.Allocate(size);
+        for (auto& ptr : ptrs)
+            pool.Free(ptr);
+        total += 3*size;
+    }
+    REQUIRE(pool.GetStatistics().bytes_cached == total);
+
+    // Each trim releases exactly the oldest block left in the depot.
+    for (size_t i = 0; i < sizes.size(); ++i)
+    {
+        total -= sizes[i];
+        pool.SetMaxCachedBytes(total);
+        CHECK(pool.GetStatistics().bytes_cached == total);
+        for (size_t j = 0; j < sizes.size(); ++j)
+            CHECK(cached_in(sizes[j]) == (j <= i ? 2UL : 3UL));
+    }
+
+    // With the depot empty, the oldest entries of each magazine go next.
+    pool.SetMaxCachedBytes(sizes[2]);
+    CHECK(pool.GetStatistics().bytes_cached == sizes[2]);
+    CHECK(cached_in(sizes[0]) == 0UL);
+    CHECK(cached_in(sizes[1]) == 0UL);
+    CHECK(cached_in(sizes[2]) == 1UL);
+
+    pool.Trim(0);
+    auto const stats = pool.GetStatistics();
+    CHECK(stats.bytes_cached == 0UL);
+    CHECK(stats.bytes_trimmed == 3*(sizes[0]+sizes[1]+sizes[2]));
+}
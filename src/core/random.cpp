@@ -13,6 +13,11 @@ namespace {
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
+// The seed shared by all processes and the number of times it was set, which
+// restarts the numbering of the counter-based streams of every grid
+std::uint32_t philoxSeed = 0;
+El::Int philoxEpoch = 0;
+
 #ifdef HYDROGEN_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
@@ -31,6 +36,14 @@ void InitializeRandom( bool deterministic )
 
     srand( seed );
 
+    // The counter-based streams must be keyed identically on every process
+    Int sharedSecs = secs;
+    if( !deterministic )
+        mpi::Broadcast
+        ( sharedSecs, 0, mpi::COMM_WORLD, SyncInfo<Device::CPU>{} );
+    ::philoxSeed = std::uint32_t(sharedSecs);
+    ++::philoxEpoch;
+
 #ifdef HYDROGEN_HAVE_MPC
     mpfr::SetMinIntBits( 256 );
     mpfr::SetPrecision( 256 );
@@ -49,6 +62,20 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+PhiloxKey NewPhiloxKey( const Grid& grid )
+{
+    // Every process of the grid keys the same sequence of streams on it, so
+    // they agree on the next one without communicating
+    auto& streams = grid.CachedPhiloxStreams();
+    if( streams.epoch != ::philoxEpoch )
+    {
+        streams.epoch = ::philoxEpoch;
+        streams.count = 0;
+    }
+    const auto stream = streams.count++;
+    return {{ ::philoxSeed, std::uint32_t(stream) }};
+}
+
 #ifdef HYDROGEN_HAVE_MPC
 namespace mpfr {
 
@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_MPIIO_HPP
+#define EL_IO_MPIIO_HPP
+
+namespace El {
+namespace mpiio {
+
+// Unlike the communication routines, MPI-IO returns its errors by default
+inline void Check( int error, const string& msg )
+{
+    if( error != MPI_SUCCESS )
+    {
+        char errorString[MPI_MAX_ERROR_STRING];
+        int errorLength;
+        MPI_Error_string( error, errorString, &errorLength );
+        RuntimeError(msg,": ",string(errorString,errorLength));
+    }
+}
+
+// A file that is collectively opened over a communicator and closed when it
+// goes out of scope
+class File
+{
+public:
+    File( mpi::Comm const& comm, const string& filename, int amode )
+    {
+        Check
+        ( MPI_File_open
+          ( comm.GetMPIComm(), const_cast<char*>(filename.c_str()), amode,
+            MPI_INFO_NULL, &file_ ),
+          "Could not open "+filename );
+    }
+    ~File() { MPI_File_close( &file_ ); }
+
+    File( const File& ) = delete;
+    File& operator=( const File& ) = delete;
+
+    MPI_File Get() const { return file_; }
+
+private:
+    MPI_File file_;
+};
+
+// A committed derived datatype that is freed when it goes out of scope
+class Datatype
+{
+public:
+    explicit Datatype( MPI_Datatype type ) : type_(type)
+    { EL_CHECK_MPI_CALL( MPI_Type_commit( &type_ ) ); }
+    ~Datatype() { MPI_Type_free( &type_ ); }
+
+    Datatype( const Datatype& ) = delete;
+    Datatype& operator=( const Datatype& ) = delete;
+
+    MPI_Datatype Get() const { return type_; }
+
+private:
+    MPI_Datatype type_;
+};
+
+template<typename T>
+MPI_Datatype EntryType()
+{
+    MPI_Datatype type;
+    EL_CHECK_MPI_CALL( MPI_Type_contiguous( sizeof(T), MPI_BYTE, &type ) );
+    return type;
+}
+
+// MPI datatypes count their blocks and entries with an int, while the
+// displacements are byte offsets stored as an MPI_Aint
+inline void CheckLocalDims( Int localHeight, Int localWidth )
+{
+    const Int intMax = std::numeric_limits<int>::max();
+    if( localHeight > intMax || localWidth > intMax )
+        LogicError
+        ("The ",localHeight," x ",localWidth," local matrix is too large to "
+         "describe with an MPI datatype");
+}
+
+// The file type that selects the local entries of A out of a column-major
+// Height x Width array of entries. The global rows owned by a process are
+// grouped into runs of consecutive indices (one per local row for element
+// distributions and one per block for block distributions), which are then
+// replicated at the offset of each owned global column.
+template<typename T>
+MPI_Datatype LocalFileType
+( const AbstractDistMatrix<T>& A, MPI_Datatype entryType )
+{
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    CheckLocalDims( localHeight, localWidth );
+
+    // There are at most localHeight runs, each of at most localHeight
+    // entries, but their starts may lie beyond the range of an int
+    vector<Int> runStarts;
+    vector<int> runLengths;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( !runStarts.empty() && runStarts.back()+runLengths.back() == i )
+            ++runLengths.back();
+        else
+        {
+            runStarts.push_back( i );
+            runLengths.push_back( 1 );
+        }
+    }
+    vector<MPI_Aint> runDispls( runStarts.size() );
+    for( size_t run=0; run<runStarts.size(); ++run )
+        runDispls[run] = MPI_Aint(runStarts[run])*sizeof(T);
+    MPI_Datatype colType;
+    EL_CHECK_MPI_CALL
+    ( MPI_Type_create_hindexed
+      ( int(runStarts.size()), runLengths.data(), runDispls.data(),
+        entryType, &colType ) );
+
+    vector<MPI_Aint> colDispls( localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        colDispls[jLoc] = MPI_Aint(A.GlobalCol(jLoc))*A.Height()*sizeof(T);
+    MPI_Datatype fileType;
+    EL_CHECK_MPI_CALL
+    ( MPI_Type_create_hindexed_block
+      ( int(localWidth), 1, colDispls.data(), colType, &fileType ) );
+    MPI_Type_free( &colType );
+    return fileType;
+}
+
+// Collectively read or write the local entries of A from or to their
+// positions within a column-major Height x Width array of entries that starts
+// 'offset' bytes into the file. Every process in the communicator that the
+// file was opened over must call this routine, but only the 'active' ones
+// transfer their local entries.
+template<typename T>
+void TransferLocal
+( MPI_File file, MPI_Offset offset,
+  const AbstractDistMatrix<T>& A, T* localBuffer, bool active, bool write )
+{
+    EL_DEBUG_CSE
+    Datatype entryType( EntryType<T>() );
+    const bool haveData =
+      active && A.LocalHeight() > 0 && A.LocalWidth() > 0;
+
+    // Processes without data use a trivial view and transfer nothing
+    MPI_Datatype fileTypeRaw = entryType.Get(), memTypeRaw = entryType.Get();
+    if( haveData )
+    {
+        fileTypeRaw = LocalFileType( A, entryType.Get() );
+        EL_CHECK_MPI_CALL
+        ( MPI_Type_create_hvector
+          ( int(A.LocalWidth()), int(A.LocalHeight()),
+            MPI_Aint(A.LDim())*sizeof(T), entryType.Get(), &memTypeRaw ) );
+    }
+    else
+    {
+        EL_CHECK_MPI_CALL( MPI_Type_dup( entryType.Get(), &fileTypeRaw ) );
+        EL_CHECK_MPI_CALL( MPI_Type_dup( entryType.Get(), &memTypeRaw ) );
+    }
+    Datatype fileType( fileTypeRaw ), memType( memTypeRaw );
+
+    Check
+    ( MPI_File_set_view
+      ( file, offset, entryType.Get(), fileType.Get(),
+        const_cast<char*>("native"), MPI_INFO_NULL ),
+      "Could not set the file view" );
+    const int count = ( haveData ? 1 : 0 );
+    if( write )
+        Check
+        ( MPI_File_write_all
+          ( file, localBuffer, count, memType.Get(), MPI_STATUS_IGNORE ),
+          "Could not write the local entries" );
+    else
+        Check
+        ( MPI_File_read_all
+          ( file, localBuffer, count, memType.Get(), MPI_STATUS_IGNORE ),
+          "Could not read the local entries" );
+}
+
+inline MPI_Offset Size( MPI_File file )
+{
+    MPI_Offset size;
+    Check( MPI_File_get_size( file, &size ), "Could not query the file size" );
+    return size;
+}
+
+} // namespace mpiio
+} // namespace El
+
+#endif // ifndef EL_IO_MPIIO_HPP
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./MPIIO.hpp"
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
@@ -77,7 +78,15 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename );
 
-    if(( A.ColStride() == 1 && A.RowStride() == 1 ) && !(A.ColDist() == STAR || A.RowDist() == STAR))
+    if( !sequential && A.GetLocalDevice() == Device::CPU &&
+        ( format == BINARY || format == BINARY_FLAT ) )
+    {
+        if( format == BINARY )
+            read::Binary( A, filename );
+        else
+            read::BinaryFlat( A, A.Height(), A.Width(), filename );
+    }
+    else if(( A.ColStride() == 1 && A.RowStride() == 1 ) && !(A.ColDist() == STAR || A.RowDist() == STAR))
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
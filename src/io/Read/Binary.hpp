@@ -40,19 +40,24 @@ Binary( Matrix<T>& A, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Every process collectively reads its own local entries through MPI-IO
 template<typename T>
 inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("read::Binary: Only implemented for CPU matrices");
+    mpiio::File file( A.Grid().ViewingComm(), filename, MPI_MODE_RDONLY );
 
-    Int height, width;
-    file.read( (char*)&height, sizeof(Int) );
-    file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
+    Int dims[2];
+    mpiio::Check
+    ( MPI_File_read_at_all
+      ( file.Get(), 0, dims, 2*sizeof(Int), MPI_BYTE, MPI_STATUS_IGNORE ),
+      "Could not read the dimensions from "+filename );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    const Int numBytes = mpiio::Size( file.Get() );
     const Int metaBytes = 2*sizeof(Int);
     const Int dataBytes = height*width*sizeof(T);
     const Int numBytesExp = metaBytes + dataBytes;
@@ -61,45 +66,8 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
 
     A.Resize( height, width );
-    if( A.CrossRank() != A.Root() )
-        return;
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-        else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
+    mpiio::TransferLocal
+    ( file.Get(), metaBytes, A, A.Buffer(), A.Participating(), false );
 }
 
 } // namespace read
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./MPIIO.hpp"
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
@@ -73,7 +74,15 @@ void Write
   string basename, FileFormat format, string title )
 {
     EL_DEBUG_CSE
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( A.GetLocalDevice() == Device::CPU &&
+        ( format == BINARY || format == BINARY_FLAT ) )
+    {
+        if( format == BINARY )
+            write::Binary( A, basename );
+        else
+            write::BinaryFlat( A, basename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
@@ -35,6 +35,39 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Every process collectively writes its own local entries through MPI-IO
+// (with only the first member of each redundant group taking part)
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("write::Binary: Only implemented for CPU matrices");
+
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm const& comm = A.Grid().ViewingComm();
+    mpiio::File file
+    ( comm, filename, MPI_MODE_CREATE | MPI_MODE_WRONLY );
+
+    const Int metaBytes = 2*sizeof(Int);
+    const Int dataBytes = A.Height()*A.Width()*sizeof(T);
+    mpiio::Check
+    ( MPI_File_set_size( file.Get(), metaBytes+dataBytes ),
+      "Could not resize "+filename );
+    if( mpi::Rank(comm) == 0 )
+    {
+        Int dims[2] = { A.Height(), A.Width() };
+        mpiio::Check
+        ( MPI_File_write_at
+          ( file.Get(), 0, dims, 2*sizeof(Int), MPI_BYTE, MPI_STATUS_IGNORE ),
+          "Could not write the dimensions to "+filename );
+    }
+    mpiio::TransferLocal
+    ( file.Get(), metaBytes, A, const_cast<T*>(A.LockedBuffer()),
+      A.Participating() && A.RedundantRank() == 0, true );
+}
+
 } // namespace write
 } // namespace El
 
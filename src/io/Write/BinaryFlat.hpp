@@ -30,6 +30,29 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Every process collectively writes its own local entries through MPI-IO
+// (with only the first member of each redundant group taking part)
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("write::BinaryFlat: Only implemented for CPU matrices");
+
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpiio::File file
+    ( A.Grid().ViewingComm(), filename, MPI_MODE_CREATE | MPI_MODE_WRONLY );
+
+    const Int dataBytes = A.Height()*A.Width()*sizeof(T);
+    mpiio::Check
+    ( MPI_File_set_size( file.Get(), dataBytes ),
+      "Could not resize "+filename );
+    mpiio::TransferLocal
+    ( file.Get(), 0, A, const_cast<T*>(A.LockedBuffer()),
+      A.Participating() && A.RedundantRank() == 0, true );
+}
+
 } // namespace write
 } // namespace El
 
@@ -46,6 +46,9 @@ void Ger2Sub
 #include "./HermitianTridiag/UpperBlocked.hpp"
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
+#include "./HermitianTridiag/LowerBand.hpp"
+#include "./HermitianTridiag/BulgeChase.hpp"
+
 #include "./HermitianTridiag/ApplyQ.hpp"
 
 namespace El {
@@ -85,7 +88,8 @@ void HermitianTridiag
         else
             herm_tridiag::UpperBlocked( A, householderScalars, ctrl.symvCtrl );
     }
-    else if( ctrl.approach == HERMITIAN_TRIDIAG_SQUARE )
+    else if( ctrl.approach == HERMITIAN_TRIDIAG_SQUARE &&
+             grid.Height() != grid.Width() )
     {
         // Drop down to a square mesh 
         const Int p = grid.Size();
@@ -110,8 +114,10 @@ void HermitianTridiag
         mpi::Incl
         ( owningGroup, squareRanks.size(), squareRanks.data(), squareGroup );
 
-        mpi::Comm viewingComm = grid.ViewingComm();
-        const Grid squareGrid( viewingComm, squareGroup, pSqrt );
+        mpi::Comm viewingComm;
+        mpi::Dup( grid.ViewingComm(), viewingComm );
+        const Grid squareGrid
+        ( std::move(viewingComm), squareGroup, pSqrt, COLUMN_MAJOR );
         DistMatrix<F> ASquare(squareGrid);
         DistMatrix<F,STAR,STAR> householderScalarsSquare(squareGrid);
 
@@ -136,7 +142,9 @@ void HermitianTridiag
     else
     {
         // Use the normal approach unless we're already on a square 
-        // grid, in which case we use the fast square method.
+        // grid, in which case we use the fast square method. This is also
+        // the fallback of the two-stage approach, since ApplyQ requires the
+        // reflectors of a one-stage reduction.
         if( grid.Height() == grid.Width() )
         {
             if( uplo == LOWER )
@@ -160,6 +168,133 @@ void HermitianTridiag
 
 namespace herm_tridiag {
 
+namespace two_stage {
+
+// Extract the lower band of A, including the diagonal, into band(i-j,j)
+template<typename F>
+void ExtractBand( const Matrix<F>& A, Matrix<F>& band, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( band, 2*bandwidth, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+bandwidth+1,n); ++i )
+            band(i-j,j) = A(i,j);
+}
+
+// Overwrite the band of A with the tridiagonal matrix held by the band storage
+template<typename F>
+void StoreTridiagonal( const Matrix<F>& band, Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = RealPart(band(0,j));
+        for( Int i=j+1; i<Min(j+bandwidth+1,n); ++i )
+            A(i,j) = ( i==j+1 ? band(1,j) : F(0) );
+    }
+}
+
+inline Int Bandwidth( Int n, Int bandwidth )
+{ return Max( Min( bandwidth==0 ? Blocksize() : bandwidth, n-1 ), Int(1) ); }
+
+template<typename F>
+void Reduce
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  BandReflectors<F>& bandReflectors,
+  Int bandwidth,
+  bool storeReflectors )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+
+    const Int n = A.Height();
+    const Int b = Bandwidth( n, bandwidth );
+    LowerBand( A, householderScalars, b );
+
+    // The chase is not distributed: the O(n b) band is summed onto every
+    // process, which then chases all of the bulges itself
+    Matrix<F> band;
+    Zeros( band, 2*b, n );
+    auto& ALoc = A.Matrix();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+b+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            band(A.GlobalRow(iLoc)-j,j) = ALoc(iLoc,jLoc);
+    }
+    mpi::AllReduce
+    ( band.Buffer(), 2*b*n, A.DistComm(), SyncInfo<Device::CPU>{} );
+    bandReflectors.bandwidth = b;
+    BulgeChase( band, bandReflectors, storeReflectors );
+
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+b+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j )
+                ALoc(iLoc,jLoc) = RealPart(band(0,j));
+            else if( i == j+1 )
+                ALoc(iLoc,jLoc) = band(1,j);
+            else
+                ALoc(iLoc,jLoc) = 0;
+        }
+    }
+}
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  BandReflectors<F>& bandReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    const Int n = A.Height();
+    const Int b = two_stage::Bandwidth( n, bandwidth );
+    LowerBand( A, householderScalars, b );
+
+    Matrix<F> band;
+    two_stage::ExtractBand( A, band, b );
+    bandReflectors.bandwidth = b;
+    BulgeChase( band, bandReflectors );
+    two_stage::StoreTridiagonal( band, A, b );
+}
+
+template<typename F>
+void TwoStage
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  BandReflectors<F>& bandReflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::Reduce( A, householderScalars, bandReflectors, bandwidth, true );
+}
+
 template<typename F>
 void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
 {
@@ -180,6 +315,22 @@ void ExplicitCondensed
 {
     EL_DEBUG_CSE
     DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
+    if( ctrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        // The two-stage reduction only reads the lower triangle, and the
+        // chase's reflectors are not needed to form the condensed matrix.
+        // Both triangles of the result hold the tridiagonal matrix.
+        DistMatrixReadWriteProxy<F,F,MC,MR> AProx( A );
+        auto& AMC_MR = AProx.Get();
+        if( uplo == UPPER )
+            MakeHermitian( UPPER, AMC_MR );
+        BandReflectors<F> bandReflectors;
+        two_stage::Reduce
+        ( AMC_MR, householderScalars, bandReflectors, ctrl.bandwidth, false );
+        MakeTrapezoidal( UPPER, AMC_MR, -1 );
+        MakeHermitian( LOWER, AMC_MR );
+        return;
+    }
     HermitianTridiag( uplo, A, householderScalars, ctrl );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
@@ -218,6 +369,28 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    herm_tridiag::BandReflectors<F>& bandReflectors, \
+    Int bandwidth ); \
+  template void herm_tridiag::TwoStage \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    herm_tridiag::BandReflectors<F>& bandReflectors, \
+    Int bandwidth ); \
+  template void herm_tridiag::ApplyQ \
+  ( Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const herm_tridiag::BandReflectors<F>& bandReflectors, \
+          Matrix<F>& B ); \
+  template void herm_tridiag::ApplyQ \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const herm_tridiag::BandReflectors<F>& bandReflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
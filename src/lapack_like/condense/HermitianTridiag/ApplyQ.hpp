@@ -55,6 +55,67 @@ void ApplyQ
       A, householderScalars, B );
 }
 
+
+template<typename F>
+void ApplyQ
+( Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const BandReflectors<F>& bandReflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    // Q = H Q_band, where H is the product of the band reduction's reflectors
+    const Int offset = -bandReflectors.bandwidth;
+    if( orientation == NORMAL )
+    {
+        ApplyBandReflectors( NORMAL, bandReflectors, B );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, offset,
+          A, householderScalars, B );
+    }
+    else
+    {
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, offset,
+          A, householderScalars, B );
+        ApplyBandReflectors( orientation, bandReflectors, B );
+    }
+}
+
+template<typename F>
+void ApplyQ
+( Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BandReflectors<F>& bandReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    // Each process owns entire columns of B within a [STAR,VR] distribution
+    // and can therefore apply the (redundantly stored) band reflectors locally
+    auto applyBandReflectors = [&]()
+    {
+        DistMatrixReadWriteProxy<F,F,STAR,VR> BProx( B );
+        ApplyBandReflectors( orientation, bandReflectors, BProx.Get().Matrix() );
+    };
+    const Int offset = -bandReflectors.bandwidth;
+    if( orientation == NORMAL )
+    {
+        applyBandReflectors();
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, offset,
+          A, householderScalars, B );
+    }
+    else
+    {
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, offset,
+          A, householderScalars, B );
+        applyBandReflectors();
+    }
+}
+
 } // namespace herm_tridiag
 } // namespace El
 
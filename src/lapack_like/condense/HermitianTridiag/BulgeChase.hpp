@@ -0,0 +1,340 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_BULGECHASE_HPP
+#define EL_HERMITIANTRIDIAG_BULGECHASE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// The second stage of TwoStage reduces a Hermitian matrix of bandwidth b,
+// whose lower triangle is stored as band(i-j,j) = A(i,j), to tridiagonal form.
+//
+// The s'th sweep first annihilates A(s+2:s+b,s) with a reflector acting on
+// rows [s+1,s+b+1); applying it from the right creates a bulge below the band,
+// and each subsequent task of the sweep annihilates the first column of the
+// previous bulge while creating the next one b rows further down. The
+// remainder of each bulge is left to the following sweeps, so that twice the
+// bandwidth must be stored.
+namespace bulge_chase {
+
+// The number of reflectors generated by the s'th of the n-1 sweeps
+inline Int NumTasks( Int n, Int b, Int s )
+{ return 1 + ( n-3-s >= 0 ? (n-3-s)/b : 0 ); }
+
+// The k'th task of the s'th sweep only touches rows [s+1+k b,s+1+(k+2) b).
+// The reflector is only kept if storeReflectors is true; otherwise it is
+// formed in the end of the workspace, which must then hold 3 b entries.
+template<typename F>
+void Task
+( Matrix<F>& band,
+  BandReflectors<F>& reflectors,
+  Int s, Int k, Int index,
+  vector<F>& work,
+  bool storeReflectors )
+{
+    const Int n = band.Width();
+    const Int b = reflectors.bandwidth;
+    const Int r0 = s+1+k*b;
+    const Int len = Min(b,n-r0);
+    const Int c = ( k==0 ? s : r0-b );
+    F* bandBuf = band.Buffer();
+    const Int bandLDim = band.LDim();
+    // Returns a pointer to the stored portion of column j starting at row i
+    auto column = [&]( Int i, Int j ) { return &bandBuf[(i-j)+j*bandLDim]; };
+
+    // Annihilate A(r0+1:r0+len,c) and store the reflector
+    F* u = ( storeReflectors ? reflectors.V.Buffer(0,index) : &work[2*b] );
+    F* a = column( r0, c );
+    const F tau = lapack::Reflector( len, a[0], &a[1], 1 );
+    u[0] = F(1);
+    for( Int i=1; i<len; ++i )
+    {
+        u[i] = a[i];
+        a[i] = 0;
+    }
+    for( Int i=len; i<b; ++i )
+        u[i] = 0;
+    if( storeReflectors )
+    {
+        reflectors.householderScalars(index) = tau;
+        reflectors.offsets(index) = r0;
+    }
+
+    // A(r0:r0+len,c+1:r0) := H A(r0:r0+len,c+1:r0)
+    for( Int j=c+1; j<r0; ++j )
+    {
+        a = column( r0, j );
+        F gamma = 0;
+        for( Int i=0; i<len; ++i )
+            gamma += Conj(u[i])*a[i];
+        gamma *= tau;
+        for( Int i=0; i<len; ++i )
+            a[i] -= gamma*u[i];
+    }
+
+    // A(R,R) := H A(R,R) H^H = A(R,R) - u w^H - w u^H, where R = [r0,r0+len),
+    // w = p - (tau u^H p/2) u, and p = conj(tau) A(R,R) u
+    F* w = work.data();
+    for( Int i=0; i<len; ++i )
+        w[i] = 0;
+    for( Int j=0; j<len; ++j )
+    {
+        a = column( r0+j, r0+j );
+        w[j] += RealPart(a[0])*u[j];
+        for( Int i=j+1; i<len; ++i )
+        {
+            w[i] += a[i-j]*u[j];
+            w[j] += Conj(a[i-j])*u[i];
+        }
+    }
+    F uDotW = 0;
+    for( Int i=0; i<len; ++i )
+    {
+        w[i] *= Conj(tau);
+        uDotW += Conj(u[i])*w[i];
+    }
+    const F alpha = -tau*uDotW/F(2);
+    for( Int i=0; i<len; ++i )
+        w[i] += alpha*u[i];
+    for( Int j=0; j<len; ++j )
+    {
+        a = column( r0+j, r0+j );
+        for( Int i=j; i<len; ++i )
+            a[i-j] -= u[i]*Conj(w[j]) + w[i]*Conj(u[j]);
+    }
+
+    // A(B,R) := A(B,R) H^H, where B = [r0+len,r0+len+b) creates the next bulge
+    const Int iBeg = r0+len;
+    const Int iEnd = Min(iBeg+b,n);
+    F* z = &work[b];
+    for( Int i=iBeg; i<iEnd; ++i )
+        z[i-iBeg] = 0;
+    for( Int j=0; j<len; ++j )
+    {
+        a = column( iBeg, r0+j );
+        for( Int i=iBeg; i<iEnd; ++i )
+            z[i-iBeg] += a[i-iBeg]*u[j];
+    }
+    for( Int i=iBeg; i<iEnd; ++i )
+        z[i-iBeg] *= Conj(tau);
+    for( Int j=0; j<len; ++j )
+    {
+        a = column( iBeg, r0+j );
+        const F upsilon = Conj(u[j]);
+        for( Int i=iBeg; i<iEnd; ++i )
+            a[i-iBeg] -= z[i-iBeg]*upsilon;
+    }
+}
+
+} // namespace bulge_chase
+
+// If storeReflectors is false, only the tridiagonal matrix is computed, which
+// requires just the O(n b) storage of the band
+template<typename F>
+void BulgeChase
+( Matrix<F>& band, BandReflectors<F>& reflectors, bool storeReflectors=true )
+{
+    EL_DEBUG_CSE
+    const Int n = band.Width();
+    const Int b = reflectors.bandwidth;
+    EL_DEBUG_ONLY(
+      if( band.Height() != 2*b )
+          LogicError("The band must be stored with twice its bandwidth");
+    )
+    const Int numSweeps = Max(n-1,Int(0));
+    vector<Int> sweepOffsets(numSweeps+1,0);
+    Int maxTasks = 0;
+    for( Int s=0; s<numSweeps; ++s )
+    {
+        const Int numTasks = bulge_chase::NumTasks( n, b, s );
+        sweepOffsets[s+1] = sweepOffsets[s] + numTasks;
+        maxTasks = Max( maxTasks, numTasks );
+    }
+    const Int numReflectors = ( storeReflectors ? sweepOffsets[numSweeps] : 0 );
+    Zeros( reflectors.V, b, numReflectors );
+    Zeros( reflectors.householderScalars, numReflectors, 1 );
+    Zeros( reflectors.offsets, numReflectors, 1 );
+
+#ifdef EL_HYBRID
+    // The k'th task of sweep s conflicts with the tasks of sweep s+1 up to
+    // its (k+1)'th, so sweep s can run its (t-3s)'th task in step t
+    // alongside those of the other sweeps. The reflectors are identical to
+    // those of the sequential ordering.
+    const Int numThreads = (omp_in_parallel() ? 1 : omp_get_max_threads());
+    if( numThreads > 1 && numSweeps > 1 )
+    {
+        const Int numSteps = 3*(numSweeps-1) + maxTasks;
+        #pragma omp parallel
+        {
+            vector<F> work(3*b);
+            for( Int t=0; t<numSteps; ++t )
+            {
+                const Int sBeg = Max( t-maxTasks+1, Int(0) ) / 3;
+                const Int sEnd = Min( t/3+1, numSweeps );
+                #pragma omp for schedule(static)
+                for( Int s=sBeg; s<sEnd; ++s )
+                {
+                    const Int k = t-3*s;
+                    if( k < sweepOffsets[s+1]-sweepOffsets[s] )
+                        bulge_chase::Task
+                        ( band, reflectors, s, k, sweepOffsets[s]+k, work,
+                          storeReflectors );
+                }
+            }
+        }
+        return;
+    }
+#endif
+    vector<F> work(3*b);
+    for( Int s=0; s<numSweeps; ++s )
+        for( Int k=0; k<sweepOffsets[s+1]-sweepOffsets[s]; ++k )
+            bulge_chase::Task
+            ( band, reflectors, s, k, sweepOffsets[s]+k, work,
+              storeReflectors );
+}
+
+namespace bulge_chase {
+
+// The reflectors of the k'th tasks of sweeps [s0,s0+numSweeps) overlap in a
+// diamond of rows and, since the k'th task of sweep s only needs to precede
+// the k'th and (k-1)'th tasks of the later sweeps, they may be accumulated
+// into the compact WY form
+//
+//   H'_{s0,k} H'_{s0+1,k} ... = I - V T V^H,
+//
+// where H'_j = I - conj(tau_j) u_j u_j^H and T is upper triangular, as long
+// as the groups of each block of sweeps are applied in decreasing order of k.
+// Returns the first row that the group acts upon.
+template<typename F>
+Int FormGroup
+( const BandReflectors<F>& reflectors,
+  const vector<Int>& sweepOffsets,
+  Int n, Int s0, Int numSweeps, Int k,
+  Matrix<F>& V, Matrix<F>& T, Matrix<F>& W )
+{
+    const Int b = reflectors.bandwidth;
+    const Int rBeg = s0+1+k*b;
+    const Int rEnd = Min(rBeg+numSweeps-1+b,n);
+    Zeros( V, rEnd-rBeg, numSweeps );
+    for( Int t=0; t<numSweeps; ++t )
+    {
+        const Int index = sweepOffsets[s0+t] + k;
+        const Int len = Min(b,rEnd-rBeg-t);
+        EL_DEBUG_ONLY(
+          if( reflectors.offsets(index) != rBeg+t )
+              LogicError("Unexpected offset of band reflector ",index);
+        )
+        MemCopy( V.Buffer(t,t), reflectors.V.LockedBuffer(0,index), len );
+    }
+
+    // T(0:t,t) := -conj(tau_t) T(0:t,0:t) V(:,0:t)^H V(:,t)
+    Zeros( T, numSweeps, numSweeps );
+    Herk( UPPER, ADJOINT, Base<F>(1), V, W );
+    for( Int t=0; t<numSweeps; ++t )
+    {
+        const F tau = Conj(reflectors.householderScalars(sweepOffsets[s0+t]+k));
+        T(t,t) = tau;
+        if( t > 0 )
+        {
+            auto T00 = T( IR(0,t), IR(0,t) );
+            auto w01 = W( IR(0,t), IR(t) );
+            auto t01 = T( IR(0,t), IR(t) );
+            Gemv( NORMAL, -tau, T00, w01, F(0), t01 );
+        }
+    }
+    return rBeg;
+}
+
+} // namespace bulge_chase
+
+// B := Q B or B := Q^H B, where Q = H_0^H H_1^H ... H_{K-1}^H is the product
+// of the adjoints of the chase's reflectors. The reflectors are applied in
+// compact WY groups of up to min(b,blocksize) consecutive sweeps so that the
+// work is performed with Gemm. Each column of B is independent.
+template<typename F>
+void ApplyBandReflectors
+( Orientation orientation,
+  const BandReflectors<F>& reflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = B.Height();
+    const Int b = reflectors.bandwidth;
+    const bool normal = ( orientation == NORMAL );
+    const Int numSweeps = Max(n-1,Int(0));
+    vector<Int> sweepOffsets(numSweeps+1,0);
+    for( Int s=0; s<numSweeps; ++s )
+        sweepOffsets[s+1] = sweepOffsets[s] + bulge_chase::NumTasks( n, b, s );
+    const Int nb = Max( Min(b,Blocksize()), Int(1) );
+    const Int numSweepBlocks = (numSweeps+nb-1) / nb;
+
+    auto applyToBlock = [&]( Matrix<F>& BBlock )
+    {
+        Matrix<F> V, T, W, Z, TZ;
+        auto applyGroup = [&]( Int s0, Int numBlockSweeps, Int k )
+        {
+            // Only a prefix of the sweeps has a k'th task
+            Int numGroupSweeps = 0;
+            while( numGroupSweeps < numBlockSweeps &&
+                   k < sweepOffsets[s0+numGroupSweeps+1] -
+                       sweepOffsets[s0+numGroupSweeps] )
+                ++numGroupSweeps;
+            if( numGroupSweeps == 0 )
+                return;
+            const Int rBeg =
+              bulge_chase::FormGroup
+              ( reflectors, sweepOffsets, n, s0, numGroupSweeps, k, V, T, W );
+            auto B1 = BBlock( IR(rBeg,rBeg+V.Height()), ALL );
+            // B1 := (I - V T V^H) B1 or B1 := (I - V T^H V^H) B1
+            Gemm( ADJOINT, NORMAL, F(1), V, B1, Z );
+            Gemm( normal ? NORMAL : ADJOINT, NORMAL, F(1), T, Z, TZ );
+            Gemm( NORMAL, NORMAL, F(-1), V, TZ, F(1), B1 );
+        };
+
+        // Q is the product over increasing sweep blocks of the products over
+        // decreasing k of the groups, so Q B applies the groups in the
+        // opposite order and Q^H B in the same order (but adjointed)
+        for( Int blockIter=0; blockIter<numSweepBlocks; ++blockIter )
+        {
+            const Int block =
+              ( normal ? numSweepBlocks-1-blockIter : blockIter );
+            const Int s0 = block*nb;
+            const Int numBlockSweeps = Min(nb,numSweeps-s0);
+            const Int numTasks = sweepOffsets[s0+1] - sweepOffsets[s0];
+            for( Int kIter=0; kIter<numTasks; ++kIter )
+            {
+                const Int k = ( normal ? kIter : numTasks-1-kIter );
+                applyGroup( s0, numBlockSweeps, k );
+            }
+        }
+    };
+
+#ifdef EL_HYBRID
+    const Int numThreads = (omp_in_parallel() ? 1 : omp_get_max_threads());
+    if( numThreads > 1 && B.Width() > 1 )
+    {
+        const Int numBlocks = Min( numThreads, B.Width() );
+        #pragma omp parallel for schedule(static,1)
+        for( Int block=0; block<numBlocks; ++block )
+        {
+            const Int jBeg = (block*B.Width()) / numBlocks;
+            const Int jEnd = ((block+1)*B.Width()) / numBlocks;
+            auto BBlock = B( ALL, IR(jBeg,jEnd) );
+            applyToBlock( BBlock );
+        }
+        return;
+    }
+#endif
+    applyToBlock( B );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_BULGECHASE_HPP
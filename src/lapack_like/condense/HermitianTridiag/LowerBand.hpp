@@ -0,0 +1,176 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_LOWERBAND_HPP
+#define EL_HERMITIANTRIDIAG_LOWERBAND_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// The first stage of TwoStage: each panel below the band is factored as
+// A21 = H D R, where D is the signature, and H^H A H is then formed from the
+// UT transform H^H = I - U inv(SInv) U^H (see ApplyPackedReflectors) as
+//
+//   A22 := A22 - U W^H - W U^H,
+//
+// with X = A22 U inv(SInv)^H and W = X - U (inv(SInv) U^H X) / 2, so that
+// all but the panel factorization is performed with Hemm and Her2k.
+// The signature is absorbed into the band so that ApplyQ need not store it.
+
+template<typename F>
+void LowerBand( Matrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    householderScalars.Resize( A.DiagonalLength(-b), 1 );
+
+    Matrix<F> panelScalars, U, SInv, X, M;
+    Matrix<Real> signature;
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+
+        const Range<Int> ind1( k,   k+b ),
+                         ind2( k+b, n   );
+
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+
+        QR( A21, panelScalars, signature );
+        Copy( panelScalars, householderScalars1 );
+        for( Int j=0; j<A21.Width(); ++j )
+            for( Int i=0; i<Min(j+1,nb); ++i )
+                A21(i,j) *= signature(i);
+
+        // Form the small triangular matrix needed for the UT transform
+        Copy( A21( ALL, IR(0,nb) ), U );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        Herk( LOWER, ADJOINT, Real(1), U, SInv );
+        for( Int j=0; j<nb; ++j )
+            SInv(j,j) = F(1) / panelScalars(j);
+
+        // X := A22 U inv(SInv)^H
+        Zeros( X, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, U, F(0), X );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv, X );
+
+        // X := X - U (inv(SInv) U^H X) / 2
+        Gemm( ADJOINT, NORMAL, F(1), U, X, M );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv, M );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), U, M, F(1), X );
+
+        Her2k( LOWER, NORMAL, F(-1), U, X, Real(1), A22 );
+    }
+}
+
+template<typename F>
+void LowerBand
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, householderScalars );
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    const Grid& g = A.Grid();
+    householderScalars.Resize( A.DiagonalLength(-b), 1 );
+
+    DistMatrix<F> U(g), X(g);
+    DistMatrix<F,MD,STAR> panelScalars(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    DistMatrix<F,STAR,STAR> panelScalars_STAR_STAR(g), SInv_STAR_STAR(g),
+                            M_STAR_STAR(g);
+    DistMatrix<Real,STAR,STAR> signature_STAR_STAR(g);
+    DistMatrix<F,VC,STAR> U_VC_STAR(g), X_VC_STAR(g);
+
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+
+        const Range<Int> ind1( k,   k+b ),
+                         ind2( k+b, n   );
+
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+
+        QR( A21, panelScalars, signature );
+        panelScalars_STAR_STAR = panelScalars;
+        signature_STAR_STAR = signature;
+        householderScalars1 = panelScalars_STAR_STAR;
+        auto& A21Loc = A21.Matrix();
+        for( Int jLoc=0; jLoc<A21.LocalWidth(); ++jLoc )
+        {
+            const Int j = A21.GlobalCol(jLoc);
+            const Int iLocEnd = A21.LocalRowOffset( Min(j+1,nb) );
+            for( Int iLoc=0; iLoc<iLocEnd; ++iLoc )
+                A21Loc(iLoc,jLoc) *=
+                  signature_STAR_STAR.GetLocal( A21.GlobalRow(iLoc), 0 );
+        }
+
+        // Form the small triangular matrix needed for the UT transform
+        U.AlignWith( A22 );
+        U = A21( ALL, IR(0,nb) );
+        MakeTrapezoidal( LOWER, U );
+        FillDiagonal( U, F(1) );
+        U_VC_STAR = U;
+        Zeros( SInv_STAR_STAR, nb, nb );
+        Herk
+        ( LOWER, ADJOINT,
+          Real(1), U_VC_STAR.LockedMatrix(),
+          Real(0), SInv_STAR_STAR.Matrix() );
+        El::AllReduce( SInv_STAR_STAR, U_VC_STAR.ColComm() );
+        for( Int j=0; j<nb; ++j )
+            SInv_STAR_STAR.SetLocal
+            ( j, j, F(1) / panelScalars_STAR_STAR.GetLocal(j,0) );
+
+        // X := A22 U inv(SInv)^H
+        X.AlignWith( A22 );
+        Zeros( X, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, U, F(0), X );
+        X_VC_STAR.AlignWith( U_VC_STAR );
+        X_VC_STAR = X;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv_STAR_STAR, X_VC_STAR );
+
+        // X := X - U (inv(SInv) U^H X) / 2
+        Zeros( M_STAR_STAR, nb, nb );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), U_VC_STAR.LockedMatrix(), X_VC_STAR.LockedMatrix(),
+          F(0), M_STAR_STAR.Matrix() );
+        El::AllReduce( M_STAR_STAR, U_VC_STAR.ColComm() );
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, M_STAR_STAR );
+        LocalGemm
+        ( NORMAL, NORMAL,
+          F(-1)/F(2), U_VC_STAR, M_STAR_STAR, F(1), X_VC_STAR );
+
+        X = X_VC_STAR;
+        Her2k( LOWER, NORMAL, F(-1), U, X, Real(1), A22 );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_LOWERBAND_HPP
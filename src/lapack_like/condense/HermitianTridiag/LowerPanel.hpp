@@ -45,6 +45,7 @@ void LowerPanel
     )
     typedef Base<F> Real;
     const Grid& g = A.Grid();
+    SyncInfo<Device::CPU> syncInfo;
     const Int r = g.Height();
     const Int c = g.Width();
     const Int p = g.Size();
@@ -155,7 +156,7 @@ void LowerPanel
             // Broadcast a21 and tau across the process row
             mpi::Broadcast
             ( rowBcastBuf.data(), 
-              a21LocalHeight+1, a21.RowAlign(), g.RowComm() );
+              a21LocalHeight+1, a21.RowAlign(), g.RowComm(), syncInfo );
             // Store a21[MC] into its DistMatrix class and also store a copy
             // for the next iteration
             MemCopy( a21_MC.Buffer(), rowBcastBuf.data(), a21LocalHeight );
@@ -196,7 +197,7 @@ void LowerPanel
             mpi::Broadcast
             ( rowBcastBuf.data(), 
               a21LocalHeight+w21LastLocalHeight+1, 
-              a21.RowAlign(), g.RowComm() );
+              a21.RowAlign(), g.RowComm(), syncInfo );
             // Store a21[MC] into its DistMatrix class 
             MemCopy( a21_MC.Buffer(), rowBcastBuf.data(), a21LocalHeight );
             // Store a21[MC] into B[MC,* ]
@@ -286,12 +287,12 @@ void LowerPanel
             // [VR,* ] <- [VC,* ]
             mpi::SendRecv
             ( sendBuf, portionSize, sendRankRM, 
-              recvBuf, portionSize, recvRankRM, g.VRComm() );
+              recvBuf, portionSize, recvRankRM, g.VRComm(), syncInfo );
 
             // [MR,* ] <- [VR,* ]
             mpi::AllGather
             ( recvBuf, portionSize,
-              sendBuf, portionSize, g.ColComm() );
+              sendBuf, portionSize, g.ColComm(), syncInfo );
 
             // Unpack
             w21Last_MR.AlignWith( alpha11 );
@@ -384,7 +385,7 @@ void LowerPanel
               q21_MR.Buffer(), q21LocalHeight );
             mpi::AllReduce
             ( colSumSendBuf.data(), colSumRecvBuf.data(),
-              2*x01LocalHeight+q21LocalHeight, g.ColComm() );
+              2*x01LocalHeight+q21LocalHeight, g.ColComm(), syncInfo );
             MemCopy
             ( x01_MR.Buffer(), 
               colSumRecvBuf.data(), x01LocalHeight );
@@ -470,7 +471,7 @@ void LowerPanel
             const Int nextProcessCol = (alpha11.RowAlign()+1) % c;
             mpi::Reduce
             ( reduceToOneSendBuf.data(), reduceToOneRecvBuf.data(),
-              2*localHeight, nextProcessCol, g.RowComm() );
+              2*localHeight, nextProcessCol, g.RowComm(), syncInfo );
             if( g.Col() == nextProcessCol )
             {
                 // Combine the second half into the first half        
@@ -490,7 +491,7 @@ void LowerPanel
                 sendBuf[0] = myDotProduct;
                 sendBuf[1] = ( g.Row()==nextProcessRow ? 
                                reduceToOneRecvBuf[0] : 0 );
-                mpi::AllReduce( sendBuf, recvBuf, 2, g.ColComm() );
+                mpi::AllReduce( sendBuf, recvBuf, 2, g.ColComm(), syncInfo );
                 F dotProduct = recvBuf[0];
 
                 // Set up for the next iteration by filling in the values for:
@@ -572,7 +573,7 @@ void LowerPanel
 
             mpi::AllReduce
             ( allReduceSendBuf.data(), allReduceRecvBuf.data(),
-              2*localHeight, g.RowComm() );
+              2*localHeight, g.RowComm(), syncInfo );
 
             // Combine the second half into the first half        
             blas::Axpy
@@ -585,7 +586,8 @@ void LowerPanel
             F myDotProduct = blas::Dot
                 ( localHeight, allReduceRecvBuf.data(), 1, 
                                a21_MC_Buf,              1 );
-            const F dotProduct = mpi::AllReduce( myDotProduct, g.ColComm() );
+            const F dotProduct =
+              mpi::AllReduce( myDotProduct, g.ColComm(), syncInfo );
 
             // Grab views into W[MC,* ] and W[MR,* ]
             auto w21_MC = W_MC_STAR( ind2, ind1 );
@@ -26,6 +26,7 @@ void LocalGPUCholesky(hydrogen::FillMode uplo,
 }// namespace
 #endif // HYDROGEN_HAVE_GPU
 
+#include "./Cholesky/PanelAllGather.hpp"
 #include "./Cholesky/LowerVariant3.hpp"
 #include "./Cholesky/UpperVariant3.hpp"
 #include "./Cholesky/ReverseLowerVariant3.hpp"
@@ -144,10 +145,27 @@ template <typename F>
 void Cholesky(UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack)
 {
     EL_DEBUG_CSE;
-    if (scalapack)
+    CholeskyCtrl ctrl;
+    ctrl.scalapack = scalapack;
+    Cholesky(uplo, A, ctrl);
+}
+
+template <typename F>
+void Cholesky(
+    UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl)
+{
+    EL_DEBUG_CSE;
+    if (ctrl.scalapack)
     {
         cholesky::ScaLAPACKHelper(uplo, A);
     }
+    else if (ctrl.lookahead > 0)
+    {
+        if (uplo == LOWER)
+            cholesky::LowerVariant3Lookahead(A, ctrl.lookahead);
+        else
+            cholesky::UpperVariant3Lookahead(A, ctrl.lookahead);
+    }
     else
     {
         if (uplo == LOWER)
@@ -261,6 +279,9 @@ void HPSDCholesky(UpperOrLower uplo, AbstractDistMatrix<F>& APre)
     template void Cholesky(UpperOrLower uplo, AbstractMatrix<F>& A);    \
     template void Cholesky(                                             \
         UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack);   \
+    template void Cholesky(                                             \
+        UpperOrLower uplo, AbstractDistMatrix<F>& A,                    \
+        const CholeskyCtrl& ctrl);                                      \
     template void Cholesky(                                             \
         UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A);
 
@@ -269,6 +290,9 @@ void HPSDCholesky(UpperOrLower uplo, AbstractDistMatrix<F>& APre)
   template void Cholesky(UpperOrLower uplo, Matrix<F>& A); \
   template void Cholesky(                                        \
       UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack);     \
+  template void Cholesky(                                        \
+      UpperOrLower uplo, AbstractDistMatrix<F>& A,                      \
+      const CholeskyCtrl& ctrl);                                        \
   template void Cholesky(UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A); \
   template void ReverseCholesky(UpperOrLower uplo, Matrix<F>& A); \
   template void ReverseCholesky \
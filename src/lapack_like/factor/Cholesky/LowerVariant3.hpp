@@ -133,6 +133,131 @@ void LowerVariant3Blocked(AbstractDistMatrix<F>& APre)
     }
 }
 
+// A version of LowerVariant3Blocked with a lookahead of depth d: each
+// factored panel only updates the next d block columns right away, and
+// the update of the rest of the trailing matrix is deferred until d more
+// panels have been factored. The all-gathers of each panel's subdiagonal
+// block into [MC,* ] and [MR,* ] are nonblocking and overlap the deferred
+// updates, so only the block column that is factored next and the panel
+// factorizations themselves are on the critical path.
+//
+// Panel j is gathered into slot j mod (d+1) of the workspace, since the
+// slots of the last d panels are still needed for their deferred updates.
+template <typename F>
+void LowerVariant3Lookahead(AbstractDistMatrix<F>& APre, Int lookahead)
+{
+    EL_DEBUG_CSE;
+    EL_DEBUG_ONLY(
+      if(APre.Height() != APre.Width())
+          LogicError("Can only compute Cholesky factor of square matrices");
+   )
+    if (lookahead < 1)
+        LogicError("The lookahead depth must be positive");
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx(APre);
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(grid);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
+
+    const Int numSlots = lookahead + 1;
+    vector<DistMatrix<F,MC,STAR>> A21_MC_STAR;
+    vector<DistMatrix<F,MR,STAR>> A21_MR_STAR;
+    for (Int s=0; s<numSlots; ++s)
+    {
+        A21_MC_STAR.emplace_back(grid);
+        A21_MR_STAR.emplace_back(grid);
+    }
+    vector<PanelAllGather<F>> gathersMC(numSlots), gathersMR(numSlots);
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int numPanels = (n+bsize-1) / bsize;
+
+    // Factor panel j, which must have received the updates from all of the
+    // preceding panels, and start gathering its subdiagonal block
+    auto factorPanel = [&](Int j)
+    {
+        const Int k = j*bsize;
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1(k,    k+nb),
+                         ind2(k+nb, n   );
+
+        auto A11 = A(ind1, ind1);
+        auto A21 = A(ind2, ind1);
+        auto A22 = A(ind2, ind2);
+
+        A11_STAR_STAR = A11;
+        Cholesky(LOWER, A11_STAR_STAR);
+        A11 = A11_STAR_STAR;
+
+        A21_VC_STAR.AlignWith(A22);
+        A21_VC_STAR = A21;
+        LocalTrsm
+        (RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR);
+
+        A21_VR_STAR.AlignWith(A22);
+        A21_VR_STAR = A21_VC_STAR;
+
+        const Int s = j % numSlots;
+        A21_MC_STAR[s].AlignWith(A22);
+        A21_MR_STAR[s].AlignWith(A22);
+        StartPartialColAllGather(A21_VC_STAR, gathersMC[s]);
+        StartPartialColAllGather(A21_VR_STAR, gathersMR[s]);
+    };
+
+    // Complete the gathers of panel j and store its subdiagonal block
+    auto finishPanel = [&](Int j)
+    {
+        const Int k = j*bsize;
+        const Int nb = Min(bsize,n-k);
+        const Int s = j % numSlots;
+        FinishPartialColAllGather(gathersMC[s], A21_MC_STAR[s]);
+        FinishPartialColAllGather(gathersMR[s], A21_MR_STAR[s]);
+        auto A21 = A(IR(k+nb,n), IR(k,k+nb));
+        A21 = A21_MC_STAR[s];
+    };
+
+    // Update block columns [j0,j1) with the gathered panel i
+    auto updateColumns = [&](Int i, Int j0, Int j1)
+    {
+        if (j0 >= j1)
+            return;
+        const Int kBelow = (i+1)*bsize;
+        const Int c0 = j0*bsize, c1 = Min(j1*bsize,n);
+        const Int s = i % numSlots;
+        auto X = A21_MC_STAR[s](IR(c0-kBelow,c1-kBelow), ALL);
+        auto Y = A21_MR_STAR[s](IR(c0-kBelow,c1-kBelow), ALL);
+        auto ADiag = A(IR(c0,c1), IR(c0,c1));
+        LocalTrrk(LOWER, ADJOINT, F(-1), X, Y, F(1), ADiag);
+        if (c1 < n)
+        {
+            auto XBelow = A21_MC_STAR[s](IR(c1-kBelow,n-kBelow), ALL);
+            auto ABelow = A(IR(c1,n), IR(c0,c1));
+            LocalGemm(NORMAL, ADJOINT, F(-1), XBelow, Y, F(1), ABelow);
+        }
+    };
+
+    if (n == 0)
+        return;
+    factorPanel(0);
+    for (Int j=1; j<numPanels; ++j)
+    {
+        finishPanel(j-1);
+        updateColumns(j-1, j, j+1);
+        factorPanel(j);
+
+        // While panel j is gathered, apply panel j-1 to the rest of its
+        // window and retire panel j-d from the block columns beyond its own
+        updateColumns(j-1, j+1, Min(j+lookahead,numPanels));
+        if (j >= lookahead)
+            updateColumns(j-lookahead, j+1, numPanels);
+    }
+    finishPanel(numPanels-1);
+}
+
 } // namespace cholesky
 } // namespace El
 
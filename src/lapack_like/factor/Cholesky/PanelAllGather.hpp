@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_PANEL_ALL_GATHER_HPP
+#define EL_CHOLESKY_PANEL_ALL_GATHER_HPP
+
+namespace El {
+namespace cholesky {
+
+// A nonblocking version of the aligned case of copy::PartialColAllGather and
+// copy::PartialRowAllGather, which redistribute a panel from [U,* ] to
+// [Partial(U),* ] (or from [* ,V] to [* ,Partial(V)]) with an all-gather
+// within the partial union communicator. Starting the gather packs the
+// panel, so the source may be reused immediately, and finishing it waits for
+// the all-gather and unpacks the result.
+template<typename F>
+struct PanelAllGather
+{
+    simple_buffer<F,Device::CPU> buffer;
+    mpi::Request<F> request;
+    bool posted=false;
+
+    Int height=0, width=0;
+    Int align=0, stride=1, strideUnion=1, stridePart=1, rankPart=0;
+    Int portionSize=0;
+};
+
+template<typename F,Dist U>
+void StartPartialColAllGather
+( const DistMatrix<F,U,STAR>& A, PanelAllGather<F>& gather )
+{
+    EL_DEBUG_CSE
+    gather.height = A.Height();
+    gather.width = A.Width();
+    gather.align = A.ColAlign();
+    gather.stride = A.ColStride();
+    gather.strideUnion = A.PartialUnionColStride();
+    gather.stridePart = A.PartialColStride();
+    gather.rankPart = A.PartialColRank();
+    gather.posted = A.Participating();
+    if( !gather.posted )
+        return;
+
+    gather.portionSize =
+      mpi::Pad( MaxLength(gather.height,gather.stride)*gather.width );
+    gather.buffer.allocate( (gather.strideUnion+1)*gather.portionSize );
+    F* sendBuf = gather.buffer.data();
+    F* recvBuf = sendBuf + gather.portionSize;
+
+    auto syncInfoA = SyncInfoFromMatrix(A.LockedMatrix());
+    copy::util::InterleaveMatrix(
+        A.LocalHeight(), gather.width,
+        A.LockedBuffer(), 1, A.LDim(),
+        sendBuf,          1, A.LocalHeight(), syncInfoA);
+    mpi::IAllGather(
+        sendBuf, gather.portionSize, recvBuf, gather.portionSize,
+        A.PartialUnionColComm(), gather.request);
+}
+
+// B must be aligned with the panel that the gather was started on
+template<typename F,Dist UPart>
+void FinishPartialColAllGather
+( PanelAllGather<F>& gather, DistMatrix<F,UPart,STAR>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.ColAlign() != Mod(gather.align,gather.stridePart) )
+          LogicError("The gathered panel was misaligned");
+    )
+    B.Resize( gather.height, gather.width );
+    if( !gather.posted )
+        return;
+
+    mpi::Wait( gather.request );
+    gather.posted = false;
+    const F* recvBuf = gather.buffer.data() + gather.portionSize;
+    copy::util::PartialColStridedUnpack(
+        gather.height, gather.width,
+        gather.align, gather.stride,
+        gather.strideUnion, gather.stridePart, gather.rankPart,
+        B.ColShift(),
+        recvBuf, gather.portionSize,
+        B.Buffer(), B.LDim(), SyncInfoFromMatrix(B.LockedMatrix()));
+}
+
+template<typename F,Dist V>
+void StartPartialRowAllGather
+( const DistMatrix<F,STAR,V>& A, PanelAllGather<F>& gather )
+{
+    EL_DEBUG_CSE
+    gather.height = A.Height();
+    gather.width = A.Width();
+    gather.align = A.RowAlign();
+    gather.stride = A.RowStride();
+    gather.strideUnion = A.PartialUnionRowStride();
+    gather.stridePart = A.PartialRowStride();
+    gather.rankPart = A.PartialRowRank();
+    gather.posted = A.Participating();
+    if( !gather.posted )
+        return;
+
+    gather.portionSize =
+      mpi::Pad( gather.height*MaxLength(gather.width,gather.stride) );
+    gather.buffer.allocate( (gather.strideUnion+1)*gather.portionSize );
+    F* sendBuf = gather.buffer.data();
+    F* recvBuf = sendBuf + gather.portionSize;
+
+    auto syncInfoA = SyncInfoFromMatrix(A.LockedMatrix());
+    copy::util::InterleaveMatrix(
+        gather.height, A.LocalWidth(),
+        A.LockedBuffer(), 1, A.LDim(),
+        sendBuf,          1, gather.height, syncInfoA);
+    mpi::IAllGather(
+        sendBuf, gather.portionSize, recvBuf, gather.portionSize,
+        A.PartialUnionRowComm(), gather.request);
+}
+
+// B must be aligned with the panel that the gather was started on
+template<typename F,Dist VPart>
+void FinishPartialRowAllGather
+( PanelAllGather<F>& gather, DistMatrix<F,STAR,VPart>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.RowAlign() != Mod(gather.align,gather.stridePart) )
+          LogicError("The gathered panel was misaligned");
+    )
+    B.Resize( gather.height, gather.width );
+    if( !gather.posted )
+        return;
+
+    mpi::Wait( gather.request );
+    gather.posted = false;
+    const F* recvBuf = gather.buffer.data() + gather.portionSize;
+    copy::util::PartialRowStridedUnpack(
+        gather.height, gather.width,
+        gather.align, gather.stride,
+        gather.strideUnion, gather.stridePart, gather.rankPart,
+        B.RowShift(),
+        recvBuf, gather.portionSize,
+        B.Buffer(), B.LDim(), SyncInfoFromMatrix(B.LockedMatrix()));
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_PANEL_ALL_GATHER_HPP
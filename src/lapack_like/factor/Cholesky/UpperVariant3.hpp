@@ -131,6 +131,123 @@ void UpperVariant3Blocked(AbstractDistMatrix<F>& APre)
     }
 }
 
+// The transpose of LowerVariant3Lookahead, which factors row panels and
+// gathers their blocks right of the diagonal into [* ,MC] and [* ,MR]
+template<typename F>
+void UpperVariant3Lookahead(AbstractDistMatrix<F>& APre, Int lookahead)
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if(APre.Height() != APre.Width())
+          LogicError("Can only compute Cholesky factor of square matrices");
+   )
+    if(lookahead < 1)
+        LogicError("The lookahead depth must be positive");
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx(APre);
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(grid);
+    DistMatrix<F,STAR,VC  > A12_STAR_VC(grid);
+
+    const Int numSlots = lookahead + 1;
+    vector<DistMatrix<F,STAR,MC>> A12_STAR_MC;
+    vector<DistMatrix<F,STAR,MR>> A12_STAR_MR;
+    for(Int s=0; s<numSlots; ++s)
+    {
+        A12_STAR_MC.emplace_back(grid);
+        A12_STAR_MR.emplace_back(grid);
+    }
+    vector<PanelAllGather<F>> gathersMC(numSlots), gathersMR(numSlots);
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int numPanels = (n+bsize-1) / bsize;
+
+    // Factor panel j, which must have received the updates from all of the
+    // preceding panels, and start gathering its superdiagonal block
+    auto factorPanel = [&](Int j)
+    {
+        const Int k = j*bsize;
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1(k,    k+nb),
+                         ind2(k+nb, n   );
+
+        auto A11 = A(ind1, ind1);
+        auto A12 = A(ind1, ind2);
+        auto A22 = A(ind2, ind2);
+
+        A11_STAR_STAR = A11;
+        Cholesky(UPPER, A11_STAR_STAR);
+        A11 = A11_STAR_STAR;
+
+        A12_STAR_VR.AlignWith(A22);
+        A12_STAR_VR = A12;
+        LocalTrsm(
+            LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR);
+
+        A12_STAR_VC.AlignWith(A22);
+        A12_STAR_VC = A12_STAR_VR;
+
+        const Int s = j % numSlots;
+        A12_STAR_MC[s].AlignWith(A22);
+        A12_STAR_MR[s].AlignWith(A22);
+        StartPartialRowAllGather(A12_STAR_VC, gathersMC[s]);
+        StartPartialRowAllGather(A12_STAR_VR, gathersMR[s]);
+    };
+
+    // Complete the gathers of panel j and store its superdiagonal block
+    auto finishPanel = [&](Int j)
+    {
+        const Int k = j*bsize;
+        const Int nb = Min(bsize,n-k);
+        const Int s = j % numSlots;
+        FinishPartialRowAllGather(gathersMC[s], A12_STAR_MC[s]);
+        FinishPartialRowAllGather(gathersMR[s], A12_STAR_MR[s]);
+        auto A12 = A(IR(k,k+nb), IR(k+nb,n));
+        A12 = A12_STAR_MR[s];
+    };
+
+    // Update block rows [j0,j1) with the gathered panel i
+    auto updateRows = [&](Int i, Int j0, Int j1)
+    {
+        if(j0 >= j1)
+            return;
+        const Int kRight = (i+1)*bsize;
+        const Int r0 = j0*bsize, r1 = Min(j1*bsize,n);
+        const Int s = i % numSlots;
+        auto X = A12_STAR_MC[s](ALL, IR(r0-kRight,r1-kRight));
+        auto Y = A12_STAR_MR[s](ALL, IR(r0-kRight,r1-kRight));
+        auto ADiag = A(IR(r0,r1), IR(r0,r1));
+        LocalTrrk(UPPER, ADJOINT, F(-1), X, Y, F(1), ADiag);
+        if(r1 < n)
+        {
+            auto YRight = A12_STAR_MR[s](ALL, IR(r1-kRight,n-kRight));
+            auto ARight = A(IR(r0,r1), IR(r1,n));
+            LocalGemm(ADJOINT, NORMAL, F(-1), X, YRight, F(1), ARight);
+        }
+    };
+
+    if(n == 0)
+        return;
+    factorPanel(0);
+    for(Int j=1; j<numPanels; ++j)
+    {
+        finishPanel(j-1);
+        updateRows(j-1, j, j+1);
+        factorPanel(j);
+
+        // While panel j is gathered, apply panel j-1 to the rest of its
+        // window and retire panel j-d from the block rows beyond its own
+        updateRows(j-1, j+1, Min(j+lookahead,numPanels));
+        if(j >= lookahead)
+            updateRows(j-lookahead, j+1, numPanels);
+    }
+    finishPanel(numPanels-1);
+}
+
 } // namespace cholesky
 } // namespace El
 
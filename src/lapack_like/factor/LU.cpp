@@ -10,6 +10,7 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/CALU.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -220,6 +221,24 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     }
 }
 
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& APre,
+  DistPermutation& P,
+  const LUCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.tournament )
+    {
+        LU( APre, P );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    lu::CALU( A, P );
+}
+
 template<typename F>
 void LU
 ( AbstractDistMatrix<F>& A,
@@ -241,6 +260,10 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( AbstractDistMatrix<F>& A, \
+    DistPermutation& P, \
+    const LUCtrl& ctrl ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
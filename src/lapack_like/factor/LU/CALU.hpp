@@ -0,0 +1,260 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_CALU_HPP
+#define EL_LU_CALU_HPP
+
+namespace El {
+namespace lu {
+
+// Communication-avoiding LU with tournament pivoting (CALU); see
+//
+//   L. Grigori, J. Demmel, and H. Xiang,
+//   "CALU: A communication optimal LU factorization algorithm",
+//   SIAM J. Matrix Anal. Appl., 32 (2011), pp. 1317--1350.
+//
+// Rather than performing one reduction over the process column per column of
+// each panel, as in lu::Panel, all of the pivots of a panel are chosen at
+// once with a tournament (TSLU): every process nominates rows of its portion
+// of the panel via partial pivoting, and pairs of nominees are then played
+// off against each other up a binary tree. The panel is then factored
+// without pivoting and the trailing matrix is updated as usual.
+
+// Overwrites the rows of W, and their indices in idx, with the (at most
+// W.Width()) rows chosen by partial pivoting, in pivot order. Unlike in
+// lu::Panel, a column without a nonzero pivot candidate is not an error, as
+// a rank-deficient subset of the rows may still take part in a tournament.
+template<typename F>
+void Nominate( Matrix<F>& W, vector<Int>& idx )
+{
+    EL_DEBUG_CSE
+    const Int m = W.Height();
+    const Int n = W.Width();
+    const Int minDim = Min(m,n);
+
+    Matrix<F> T( W );
+    F* TBuf = T.Buffer();
+    const Int TLDim = T.LDim();
+    vector<Int> rows(m);
+    for( Int i=0; i<m; ++i )
+        rows[i] = i;
+    auto leaf = [&]( Int k )
+    {
+        const Int iPiv = blas::MaxInd( m-k, &TBuf[k+k*TLDim], 1 ) + k;
+        if( iPiv != k )
+        {
+            blas::Swap( minDim, &TBuf[k], TLDim, &TBuf[iPiv], TLDim );
+            std::swap( rows[k], rows[iPiv] );
+        }
+
+        const F alpha = TBuf[k+k*TLDim];
+        if( alpha != F(0) )
+            blas::Scal( m-(k+1), F(1)/alpha, &TBuf[(k+1)+k*TLDim], 1 );
+    };
+    // Only the first minDim columns influence the choice of pivots
+    if( minDim > 0 )
+        RecursivePanel( m, Int(0), minDim, TBuf, TLDim, leaf );
+
+    // The nominees are the original rows rather than their eliminated forms
+    Matrix<F> WNom( minDim, n );
+    vector<Int> idxNom( minDim );
+    for( Int i=0; i<minDim; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+            WNom(i,j) = W(rows[i],j);
+        idxNom[i] = idx[rows[i]];
+    }
+    W = WNom;
+    idx = idxNom;
+}
+
+// Returns the indices of the rows of APan chosen as pivots, in pivot order,
+// on every process. Each process column holds a copy of the panel and
+// redundantly plays its own tournament, which requires ceil(log2(p))
+// exchanges of at most n x n candidate blocks and a final broadcast of the
+// n pivot indices.
+template<typename F>
+void Tournament( const DistMatrix<F,MC,STAR>& APan, vector<Int>& pivots )
+{
+    EL_DEBUG_CSE
+    const Int n = APan.Width();
+    const Int localHeight = APan.LocalHeight();
+    const mpi::Comm& colComm = APan.ColComm();
+    const int colRank = APan.ColRank();
+    const int colStride = APan.ColStride();
+    SyncInfo<Device::CPU> syncInfo;
+    EL_DEBUG_ONLY(
+      if( APan.Height() < n )
+          LogicError("Must be a column panel");
+    )
+
+    Matrix<F> W( APan.LockedMatrix() );
+    vector<Int> idx( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        idx[iLoc] = APan.GlobalRow(iLoc);
+    Nominate( W, idx );
+
+    // The first entry of each header is the number of nominees, which may be
+    // less than n for processes owning fewer than n rows of the panel
+    vector<Int> header( n+1 );
+    vector<F> buf;
+    for( int dist=1; dist<colStride; dist*=2 )
+    {
+        if( colRank % (2*dist) == dist )
+        {
+            const Int numNom = W.Height();
+            header[0] = numNom;
+            std::copy( idx.begin(), idx.end(), header.begin()+1 );
+            FastResize( buf, numNom*n );
+            lapack::Copy
+            ( 'F', numNom, n, W.LockedBuffer(), W.LDim(),
+              buf.data(), Max(numNom,Int(1)) );
+            mpi::Send( header.data(), n+1, colRank-dist, colComm, syncInfo );
+            mpi::Send( buf.data(), numNom*n, colRank-dist, colComm, syncInfo );
+            break;
+        }
+        else if( colRank % (2*dist) == 0 && colRank+dist < colStride )
+        {
+            mpi::Recv( header.data(), n+1, colRank+dist, colComm, syncInfo );
+            const Int numRecv = header[0];
+            FastResize( buf, numRecv*n );
+            mpi::Recv( buf.data(), numRecv*n, colRank+dist, colComm, syncInfo );
+
+            const Int numNom = W.Height();
+            Matrix<F> WStack( numNom+numRecv, n );
+            lapack::Copy
+            ( 'F', numNom, n, W.LockedBuffer(), W.LDim(),
+              WStack.Buffer(), WStack.LDim() );
+            lapack::Copy
+            ( 'F', numRecv, n, buf.data(), Max(numRecv,Int(1)),
+              WStack.Buffer(numNom,0), WStack.LDim() );
+            idx.insert( idx.end(), header.begin()+1, header.begin()+1+numRecv );
+            Nominate( WStack, idx );
+            W = WStack;
+        }
+    }
+
+    // The root of the tree has chosen all n pivots
+    if( colRank == 0 )
+        std::copy( idx.begin(), idx.end(), header.begin() );
+    mpi::Broadcast( header.data(), n, 0, colComm, syncInfo );
+    pivots.assign( header.begin(), header.begin()+n );
+}
+
+// Converts the chosen pivot rows into the sequence of swaps expected by
+// P and PB, with P offset by 'offset'
+inline void
+ApplyPivots
+( const vector<Int>& pivots,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    // Only the rows displaced by earlier swaps are tracked
+    std::map<Int,Int> rowAtPos, posOfRow;
+    auto rowAt = [&]( Int pos )
+      { auto it = rowAtPos.find(pos);
+        return it == rowAtPos.end() ? pos : it->second; };
+    auto posOf = [&]( Int row )
+      { auto it = posOfRow.find(row);
+        return it == posOfRow.end() ? row : it->second; };
+
+    const Int n = pivots.size();
+    for( Int k=0; k<n; ++k )
+    {
+        const Int iPiv = posOf( pivots[k] );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+
+        const Int rowK = rowAt( k );
+        rowAtPos[k] = pivots[k];
+        posOfRow[pivots[k]] = k;
+        rowAtPos[iPiv] = rowK;
+        posOfRow[rowK] = iPiv;
+    }
+}
+
+template<typename F>
+void CALU( DistMatrix<F>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,  MC,  STAR> AB1_MC_STAR(g);
+    DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    P.SetGrid( g );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    DistPermutation PB(g);
+
+    vector<Int> pivots;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const IR ind0( 0, k ), ind1( k, k+nb ), ind2( k+nb, END ),
+                 indB( k, END );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        auto AB0 = A( indB, ind0 );
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+
+        AB1_MC_STAR.AlignWith( AB1 );
+        AB1_MC_STAR = AB1;
+        Tournament( AB1_MC_STAR, pivots );
+
+        PB.MakeIdentity( m-k );
+        PB.ReserveSwaps( nb );
+        ApplyPivots( pivots, P, PB, k );
+        PB.PermuteRows( AB0 );
+        PB.PermuteRows( AB1_MC_STAR );
+        PB.PermuteRows( AB2 );
+
+        // The pivot rows are now on top and need not be pivoted amongst
+        // themselves, as the tournament already played them off in order
+        A11_STAR_STAR = AB1_MC_STAR( IR(0,nb), ALL );
+        LU( A11_STAR_STAR );
+
+        auto A21_MC_STAR = AB1_MC_STAR( IR(nb,END), ALL );
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR, A21_MC_STAR );
+
+        // Perhaps we should give up perfectly distributing this operation since
+        // it's total contribution is only O(n^2)
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+        LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+
+        A11 = A11_STAR_STAR;
+        A12 = A12_STAR_MR;
+        A21 = A21_MC_STAR;
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_CALU_HPP
@@ -145,13 +145,13 @@ void RankOneMod
 
             Axpy( -eta, lBi, lBip1 );
             A(i+1,i) = gamma/delta_i;
-            lBi   *= F(1)/delta_i;
-            lBip1 *= F(1)/delta_ip1;
+            Scale( F(1)/delta_i, lBi );
+            Scale( F(1)/delta_ip1, lBip1 );
 
             A(i,i) = eta*ups_ii*delta_i;
             Axpy( eta, uip1R, uiR );
-            uiR   *= delta_i;
-            uip1R *= delta_ip1;
+            Scale( delta_i, uiR );
+            Scale( delta_ip1, uip1R );
             uSub(i) = ups_ii*delta_ip1;
 
             // Finally set w(i)
@@ -258,13 +258,13 @@ void RankOneMod
 
             Axpy( -eta, lBi, lBip1 );
             A(i+1,i) = gamma/delta_i;
-            lBi   *= F(1)/delta_i;
-            lBip1 *= F(1)/delta_ip1;
+            Scale( F(1)/delta_i, lBi );
+            Scale( F(1)/delta_ip1, lBip1 );
 
             A(i,i) = ups_ip1i*delta_i;
             Axpy( eta, uip1R, uiR );
-            uiR   *= delta_i;
-            uip1R *= delta_ip1;
+            Scale( delta_i, uiR );
+            Scale( delta_ip1, uip1R );
         }
         else
         {
@@ -403,13 +403,13 @@ void RankOneMod
 
             Axpy( -eta, lBi, lBip1 );
             A.Set( i+1, i, gamma/delta_i );
-            lBi   *= F(1)/delta_i;
-            lBip1 *= F(1)/delta_ip1;
+            Scale( F(1)/delta_i, lBi );
+            Scale( F(1)/delta_ip1, lBip1 );
 
             A.Set( i, i, eta*ups_ii*delta_i );
             Axpy( eta, uip1R, uiR );
-            uiR   *= delta_i;
-            uip1R *= delta_ip1;
+            Scale( delta_i, uiR );
+            Scale( delta_ip1, uip1R );
             uSub.Set( i, 0, ups_ii*delta_ip1 );
 
             // Finally set w(i)
@@ -516,13 +516,13 @@ void RankOneMod
             const F delta_ip1 = F(1) - eta*gamma;
             Axpy( -eta, lBi, lBip1 );
             A.Set( i+1, i, gamma/delta_i );
-            lBi   *= F(1)/delta_i;
-            lBip1 *= F(1)/delta_ip1;
+            Scale( F(1)/delta_i, lBi );
+            Scale( F(1)/delta_ip1, lBip1 );
 
             A.Set( i, i, ups_ip1i*delta_i );
             Axpy( eta, uip1R, uiR );
-            uiR   *= delta_i;
-            uip1R *= delta_ip1;
+            Scale( delta_i, uiR );
+            Scale( delta_ip1, uip1R );
         }
         else
         {
@@ -12,6 +12,77 @@
 namespace El {
 namespace lu {
 
+// Updates the trailing rows of a panel, C := C - A B, where C is m x n and
+// usually much taller than it is wide, one row block per thread
+template<typename F>
+void RowBlockedGemmUpdate
+( Int m, Int n, Int k,
+  const F* A, Int ALDim,
+  const F* B, Int BLDim,
+        F* C, Int CLDim )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    // A nested parallel region would only be given a single thread
+    const Int numThreads = ( omp_in_parallel() ? 1 : omp_get_max_threads() );
+#else
+    const Int numThreads = 1;
+#endif
+    const Int minBlockHeight = 64;
+    const Int numBlocks = Max( Min( numThreads, m/minBlockHeight ), Int(1) );
+    const Int blockHeight = (m+numBlocks-1) / numBlocks;
+
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int i0 = block*blockHeight;
+        const Int mBlock = Min( blockHeight, m-i0 );
+        if( mBlock > 0 )
+            blas::Gemm
+            ( 'N', 'N', mBlock, n, k,
+              F(-1), &A[i0], ALDim, B, BLDim, F(1), &C[i0], CLDim );
+    }
+}
+
+// Recursively factors columns [j0,j1) of the column-major m x n panel held in
+// ABuf by splitting them in halves (as in Toledo's algorithm and LAPACK's
+// xGETRF2), so that all but O(n^2) of the work on the tall panel is performed
+// by Trsm and Gemm rather than rank-one updates.
+//
+// The pivot search, row swap, and scaling of column k are delegated to
+// leaf(k), which must swap entire rows of the panel so that the factored
+// columns to the left and the pending columns to the right are both permuted.
+template<typename F,typename LeafFunctor>
+void RecursivePanel
+( Int m, Int j0, Int j1, F* ABuf, Int ALDim, LeafFunctor& leaf )
+{
+    EL_DEBUG_CSE
+    if( j1-j0 == 1 )
+    {
+        leaf( j0 );
+        return;
+    }
+    const Int jMid = j0 + (j1-j0)/2;
+    const Int nLeft = jMid-j0;
+    const Int nRight = j1-jMid;
+
+    RecursivePanel( m, j0, jMid, ABuf, ALDim, leaf );
+
+    // A12 := inv(L11) A12
+    blas::Trsm
+    ( 'L', 'L', 'N', 'U', nLeft, nRight,
+      F(1), &ABuf[j0+j0*ALDim], ALDim, &ABuf[j0+jMid*ALDim], ALDim );
+
+    // A22 := A22 - A21 A12
+    RowBlockedGemmUpdate
+    ( m-jMid, nRight, nLeft,
+      &ABuf[jMid+j0*ALDim], ALDim,
+      &ABuf[j0+jMid*ALDim], ALDim,
+      &ABuf[jMid+jMid*ALDim], ALDim );
+
+    RecursivePanel( m, jMid, j1, ABuf, ALDim, leaf );
+}
+
 template<typename F>
 void Panel( Matrix<F>& A, Permutation& P, Permutation& PB, Int offset )
 {
@@ -27,18 +98,13 @@ void Panel( Matrix<F>& A, Permutation& P, Permutation& PB, Int offset )
 
     PB.MakeIdentity( A.Height() );
     PB.ReserveSwaps( n );
+    if( n == 0 )
+        return;
 
-    for( Int k=0; k<n; ++k )
+    auto leaf = [&]( Int k )
     {
-        const Int ind2HorzSize = n - (k+1);
-        const Int ind2VertSize = m - (k+1);
-        const F* a12Buf = &ABuf[ k    + (k+1)*ALDim];
-        const F* aB1Buf = &ABuf[ k    +  k   *ALDim];
-              F* a21Buf = &ABuf[(k+1) +  k   *ALDim];
-              F* A22Buf = &ABuf[(k+1) + (k+1)*ALDim];
-
         // Find the index and value of the pivot candidate
-        const Int maxInd = blas::MaxInd( ind2VertSize+1, aB1Buf, 1 );
+        const Int maxInd = blas::MaxInd( m-k, &ABuf[k+k*ALDim], 1 );
         const Int iPiv = maxInd + k;
         P.Swap( k+offset, iPiv+offset );
         PB.Swap( k, iPiv );
@@ -47,16 +113,12 @@ void Panel( Matrix<F>& A, Permutation& P, Permutation& PB, Int offset )
         if( iPiv != k )
             blas::Swap( n, &ABuf[k], ALDim, &ABuf[iPiv], ALDim );
 
-        // Now we can perform the update of the current panel
         const F alpha = ABuf[k+k*ALDim];
         if( alpha == F(0) )
             throw SingularMatrixException();
-        const F alpha11Inv = F(1) / alpha;
-        blas::Scal( ind2VertSize, alpha11Inv, a21Buf, 1 );
-        blas::Geru
-        ( ind2VertSize, ind2HorzSize,
-          F(-1), a21Buf, 1, a12Buf, ALDim, A22Buf, ALDim );
-    }
+        blas::Scal( m-(k+1), F(1)/alpha, &ABuf[(k+1)+k*ALDim], 1 );
+    };
+    RecursivePanel( m, Int(0), n, ABuf, ALDim, leaf );
 }
 
 // NOTE: It is assumed that the local buffers of A[*,*] and B[MC,*] can be
@@ -81,7 +143,8 @@ void Panel
     F* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
-    mpi::Comm colComm = B.ColComm();
+    const mpi::Comm& colComm = B.ColComm();
+    SyncInfo<Device::CPU> syncInfo;
     mpi::Op maxLocOp = mpi::MaxLocOp<Real>();
     EL_DEBUG_ONLY(
       AssertSameGrids( A, B );
@@ -95,13 +158,16 @@ void Panel
     PB.ReserveSwaps( n );
 
     pivotBuffer.resize( n );
-    for( Int k=0; k<n; ++k )
+    if( n == 0 )
+        return;
+
+    // The local rows of A and B form a single (n+BLocHeight) x n panel, of
+    // which each process holds the same copy of the first n rows
+    auto leaf = [&]( Int k )
     {
         const Int ind2Size = n-k-1;
-        const F* a12Buf = &ABuf[ k    + (k+1)*ALDim];
         const F* aB1Buf = &ABuf[ k    +  k   *ALDim];
               F* a21Buf = &ABuf[(k+1) +  k   *ALDim];
-              F* A22Buf = &ABuf[(k+1) + (k+1)*ALDim];
 
         // Store the index/value of the local pivot candidate
         Int aB1LocalInd = blas::MaxInd( ind2Size+1+BLocHeight, aB1Buf, 1 ); 
@@ -113,7 +179,8 @@ void Panel
             localPivot.index = B.GlobalRow(aB1LocalInd-(n-k)) + n;
 
         // Compute and store the location of the new pivot
-        const auto pivot = mpi::AllReduce( localPivot, maxLocOp, colComm );
+        const auto pivot = 
+          mpi::AllReduce( localPivot, maxLocOp, colComm, syncInfo );
         const Int iPiv = pivot.index;
         P.Swap( k+offset, iPiv+offset );
         PB.Swap( k, iPiv );
@@ -138,22 +205,20 @@ void Panel
                     BBuf[iLoc+j*BLDim] = ABuf[k+j*ALDim];
             }
             // The owning row broadcasts within process columns
-            mpi::Broadcast( pivotBuffer.data(), n, ownerRow, colComm );
+            mpi::Broadcast
+            ( pivotBuffer.data(), n, ownerRow, colComm, syncInfo );
             // Overwrite the current row with the pivot row
             for( Int j=0; j<n; ++j )
                 ABuf[k+j*ALDim] = pivotBuffer[j];
         }
 
-        // Now we can perform the update of the current panel
         const F alpha = aB1Buf[0];
         if( alpha == F(0) )
             throw SingularMatrixException();
         const F alpha11Inv = F(1) / alpha;
         blas::Scal( ind2Size+BLocHeight, alpha11Inv, a21Buf, 1 );
-        blas::Geru
-        ( ind2Size+BLocHeight, ind2Size, F(-1),
-          a21Buf, 1, a12Buf, ALDim, A22Buf, ALDim );
-    }
+    };
+    RecursivePanel( n+BLocHeight, Int(0), n, ABuf, ALDim, leaf );
 }
 
 } // namespace lu
@@ -18,6 +18,7 @@
 #include "./QR/ColSwap.hpp"
 
 #include "./QR/TS.hpp"
+#include "./QR/CA.hpp"
 
 namespace El {
 
@@ -206,7 +207,12 @@ void QR
   template void qr::ts::Reduce \
   ( const AbstractDistMatrix<F>& A, TreeData<F>& treeData ); \
   template void qr::ts::Scatter \
-  ( AbstractDistMatrix<F>& A, const TreeData<F>& treeData );
+  ( AbstractDistMatrix<F>& A, const TreeData<F>& treeData ); \
+  template void qr::CA \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature, \
+    TSQRTree tree );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,330 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_CA_HPP
+#define EL_QR_CA_HPP
+
+#include "./ApplyQ.hpp"
+
+namespace El {
+namespace qr {
+
+// Communication-avoiding QR (CAQR); see
+//
+//   J. Demmel, L. Grigori, M. Hoemmen, and J. Langou,
+//   "Communication-optimal parallel and sequential QR and LU factorizations",
+//   SIAM J. Sci. Comput., 34 (2012), pp. A206--A239,
+//
+// and, for the recovery of the Householder form of each panel,
+//
+//   G. Ballard, J. Demmel, L. Grigori, M. Jacquelin, H. D. Nguyen, and
+//   E. Solomonik, "Reconstructing Householder vectors from Tall-Skinny QR",
+//   J. Parallel Distrib. Comput., 85 (2015), pp. 3--31.
+//
+// Each process column redundantly factors its copy of the panel with a TSQR
+// reduction over the process column and then forms the explicit thin Q by
+// running the tree in reverse. Since Q - [S; 0] = Y U has a stable LU
+// factorization without pivoting when each S(i,i) is chosen as minus the sign
+// of the i'th pivot as it is reached, the unit lower-trapezoidal Y holds the
+// Householder vectors and the Householder scalars are -conj(U(i,i)) S(i,i),
+// whereas S R is the triangular factor.
+
+namespace ca {
+
+// The QR factorization of this process's current triangle stacked on top of
+// the triangles received from its children, if any
+template<typename F>
+struct TreeNode
+{
+    Matrix<F> QRFact, householderScalars;
+    Matrix<Base<F>> signature;
+
+    // The height of this process's contribution to the stack
+    Int height=0;
+
+    // The ranks of the children and the heights of their triangles, in the
+    // order in which they were stacked
+    vector<std::pair<int,Int>> children;
+};
+
+template<typename F>
+struct Tree
+{
+    // The first node is the factorization of the local rows and each
+    // subsequent node is that of a level of the reduction
+    vector<TreeNode<F>> nodes;
+
+    // The rank that the final triangle was sent to (if any) and its height
+    int parent=-1;
+    Int height=0;
+};
+
+// Returns a contiguous copy of the triangle of a factored stack
+template<typename F>
+Matrix<F> Triangle( const Matrix<F>& QRFact )
+{
+    const Int n = QRFact.Width();
+    const Int r = Min(QRFact.Height(),n);
+    Matrix<F> R( r, n );
+    lapack::Copy
+    ( 'F', r, n, QRFact.LockedBuffer(), QRFact.LDim(), R.Buffer(), R.LDim() );
+    MakeTrapezoidal( UPPER, R );
+    return R;
+}
+
+// Overwrites the top square of the thin Q with the LU factorization of
+// Q1 - S, where S(i) = -sgn(pivot) is chosen from the i'th Schur complement
+// (the "modified LU" of Ballard et al.) so that no pivot is smaller than one
+template<typename F>
+void ModifiedLU( Matrix<F>& Q1, Matrix<F>& S )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = Q1.Height();
+    S.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        const F psi = Q1(j,j);
+        const Real psiAbs = Abs(psi);
+        S(j) = ( psiAbs == Real(0) ? F(-1) : -psi/psiAbs );
+        Q1(j,j) -= S(j);
+
+        blas::Scal( n-(j+1), F(1)/Q1(j,j), Q1.Buffer(j+1,j), 1 );
+        blas::Geru
+        ( n-(j+1), n-(j+1),
+          F(-1), Q1.LockedBuffer(j+1,j), 1, Q1.LockedBuffer(j,j+1), Q1.LDim(),
+                 Q1.Buffer(j+1,j+1), Q1.LDim() );
+    }
+}
+
+// Factors the local rows of the panel, W, and reduces the triangles over
+// 'comm' with the requested tree. The triangle of the entire panel is
+// returned on the root (rank zero), and the tree is recorded for Scatter.
+template<typename F>
+Matrix<F> Reduce
+( const Matrix<F>& W, Tree<F>& tree, const mpi::Comm& comm,
+  TSQRTree treeType )
+{
+    EL_DEBUG_CSE
+    const Int n = W.Width();
+    const int rank = mpi::Rank( comm );
+    const int p = mpi::Size( comm );
+    SyncInfo<Device::CPU> syncInfo;
+
+    tree.nodes.resize( 1 );
+    auto& leaf = tree.nodes[0];
+    leaf.QRFact = W;
+    leaf.height = W.Height();
+    QR( leaf.QRFact, leaf.householderScalars, leaf.signature );
+    Matrix<F> R = Triangle( leaf.QRFact );
+
+    auto sendTo = [&]( int parent )
+    {
+        tree.parent = parent;
+        tree.height = R.Height();
+        mpi::Send( tree.height, parent, comm );
+        mpi::Send( R.LockedBuffer(), tree.height*n, parent, comm, syncInfo );
+    };
+    auto combine = [&]( const vector<int>& childRanks )
+    {
+        TreeNode<F> node;
+        node.height = R.Height();
+        vector<Matrix<F>> childTriangles( childRanks.size() );
+        Int stackHeight = node.height;
+        for( size_t c=0; c<childRanks.size(); ++c )
+        {
+            const Int r = mpi::Recv<Int>( childRanks[c], comm );
+            auto& RChild = childTriangles[c];
+            RChild.Resize( r, n, Max(r,Int(1)) );
+            mpi::Recv( RChild.Buffer(), r*n, childRanks[c], comm, syncInfo );
+            node.children.emplace_back( childRanks[c], r );
+            stackHeight += r;
+        }
+
+        // Stack the triangles and factor the stack densely
+        node.QRFact.Resize( stackHeight, n );
+        auto QRFactTop = node.QRFact( IR(0,node.height), ALL );
+        Copy( R, QRFactTop );
+        Int offset = node.height;
+        for( auto& RChild : childTriangles )
+        {
+            auto QRFactChild =
+              node.QRFact( IR(offset,offset+RChild.Height()), ALL );
+            Copy( RChild, QRFactChild );
+            offset += RChild.Height();
+        }
+        QR( node.QRFact, node.householderScalars, node.signature );
+        R = Triangle( node.QRFact );
+        tree.nodes.push_back( std::move(node) );
+    };
+
+    if( treeType == TSQR_FLAT_TREE )
+    {
+        if( rank == 0 )
+        {
+            vector<int> childRanks;
+            for( int q=1; q<p; ++q )
+                childRanks.push_back( q );
+            if( p > 1 )
+                combine( childRanks );
+        }
+        else
+            sendTo( 0 );
+    }
+    else
+    {
+        // Unlike ts::Reduce, an unpaired process simply moves up a level
+        for( int dist=1; dist<p; dist*=2 )
+        {
+            if( rank % (2*dist) == dist )
+            {
+                sendTo( rank-dist );
+                break;
+            }
+            else if( rank % (2*dist) == 0 && rank+dist < p )
+                combine( vector<int>(1,rank+dist) );
+        }
+    }
+    return R;
+}
+
+// Runs the tree in reverse to overwrite W with the local rows of the thin Q
+template<typename F>
+void Scatter( Matrix<F>& W, const Tree<F>& tree, const mpi::Comm& comm )
+{
+    EL_DEBUG_CSE
+    const Int n = W.Width();
+    SyncInfo<Device::CPU> syncInfo;
+
+    // Z holds the rows of Q corresponding to the current node's triangle
+    Matrix<F> Z;
+    if( tree.parent < 0 )
+        Identity( Z, Min(tree.nodes.back().QRFact.Height(),n), n );
+    else
+    {
+        Z.Resize( tree.height, n, Max(tree.height,Int(1)) );
+        mpi::Recv( Z.Buffer(), tree.height*n, tree.parent, comm, syncInfo );
+    }
+
+    Matrix<F> Y, YChild;
+    for( Int k=tree.nodes.size()-1; k>=0; --k )
+    {
+        const auto& node = tree.nodes[k];
+        Zeros( Y, node.QRFact.Height(), n );
+        auto YTop = Y( IR(0,Z.Height()), ALL );
+        Copy( Z, YTop );
+        ApplyQ
+        ( LEFT, NORMAL,
+          node.QRFact, node.householderScalars, node.signature, Y );
+
+        Int offset = node.height;
+        for( const auto& child : node.children )
+        {
+            Copy( Y( IR(offset,offset+child.second), ALL ), YChild );
+            mpi::Send
+            ( YChild.LockedBuffer(), child.second*n, child.first, comm,
+              syncInfo );
+            offset += child.second;
+        }
+        Copy( Y( IR(0,node.height), ALL ), Z );
+    }
+    Copy( Z, W );
+}
+
+} // namespace ca
+
+template<typename F>
+void CA
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  TSQRTree treeType )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    typedef Base<F> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int minDim = Min(m,n);
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Real,Real,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    const Grid& g = A.Grid();
+    const mpi::Comm& colComm = g.ColComm();
+    SyncInfo<Device::CPU> syncInfo;
+    DistMatrix<F,MC,  STAR> AB1_MC_STAR(g);
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    Matrix<F> R, S;
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         indB( k,    END  ),
+                         ind2( k+nb, END  );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+
+        // Overwrite our copy of the panel with its explicit thin Q and
+        // broadcast R from the root of the tree
+        AB1_MC_STAR.AlignWith( AB1 );
+        AB1_MC_STAR = AB1;
+        auto& WLoc = AB1_MC_STAR.Matrix();
+        ca::Tree<F> tree;
+        R = ca::Reduce( WLoc, tree, colComm, treeType );
+        ca::Scatter( WLoc, tree, colComm );
+        if( mpi::Rank(colComm) != 0 )
+            R.Resize( nb, nb, nb );
+        mpi::Broadcast( R.Buffer(), nb*nb, 0, colComm, syncInfo );
+
+        // Factor Q - [S; 0] = Y U without pivoting
+        A11_STAR_STAR = AB1_MC_STAR( IR(0,nb), ALL );
+        auto& Y11 = A11_STAR_STAR.Matrix();
+        ca::ModifiedLU( Y11, S );
+        auto AB1Bot_MC_STAR = AB1_MC_STAR( IR(nb,END), ALL );
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT,
+          F(1), A11_STAR_STAR, AB1Bot_MC_STAR );
+
+        // Replace U with S R, rescaled so that its diagonal has a
+        // non-negative real part as in PanelHouseholder
+        for( Int i=0; i<nb; ++i )
+        {
+            householderScalars1.Set( i, 0, -Conj(Y11(i,i))*S(i) );
+            const Real sgn =
+              ( RealPart(S(i)*R(i,i)) >= Real(0) ? Real(1) : Real(-1) );
+            sig1.Set( i, 0, sgn );
+            for( Int j=i; j<nb; ++j )
+                Y11(i,j) = sgn*S(i)*R(i,j);
+        }
+        auto AB1Top_MC_STAR = AB1_MC_STAR( IR(0,nb), ALL );
+        AB1Top_MC_STAR = A11_STAR_STAR;
+        AB1 = AB1_MC_STAR;
+
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_CA_HPP
@@ -23,7 +23,8 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     )
     const Int m =  A.Height();
     const Int n = A.Width();
-    const mpi::Comm colComm = A.ColComm();
+    const mpi::Comm& colComm = A.ColComm();
+    SyncInfo<Device::CPU> syncInfo;
     const Int p = mpi::Size( colComm );
     if( p == 1 )
         return;
@@ -52,13 +53,13 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
         {
             ZTop = lastZ;
             MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
+            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm, syncInfo );
         }
         else
         {
             ZBot = lastZ;
             MakeTrapezoidal( UPPER, ZBot );
-            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
+            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm, syncInfo );
             break;
         }
 
@@ -70,8 +71,8 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
         signature.Resize( n, 1 );
         auto QRFactTop = QRFact( IR(0,n),   IR(0,n) );
         auto QRFactBot = QRFact( IR(n,2*n), IR(0,n) );
-        QRFactTop = ZTop;
-        QRFactBot = ZBot;
+        Copy( ZTop, QRFactTop );
+        Copy( ZBot, QRFactBot );
 
         // Note that the last QR is not performed by this routine, as many
         // higher-level routines, such as TS-SVT, are simplified if the final
@@ -194,7 +195,8 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
     )
     const Int m = A.Height();
     const Int n = A.Width();
-    const mpi::Comm colComm = A.ColComm();
+    const mpi::Comm& colComm = A.ColComm();
+    SyncInfo<Device::CPU> syncInfo;
     const Int p = mpi::Size( colComm );
     if( p == 1 )
         return;
@@ -225,7 +227,7 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
             if( stage < logp-1 )
             {
                 // Multiply by the current Q
-                ZTop = ZHalf;
+                Copy( ZHalf, ZTop );
                 Zero( ZBot );
 
                 // TODO: Exploit sparsity?
@@ -238,26 +240,27 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
             }
             // Send bottom-half to partner and keep top half
             ZHalf = ZBot;
-            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm );
+            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm, syncInfo );
             ZHalf = ZTop;
         }
         else
         {
             // Recv top half from partner
-            mpi::Recv( ZHalf.Buffer(), n*n, partner, colComm );
+            mpi::Recv( ZHalf.Buffer(), n*n, partner, colComm, syncInfo );
         }
     }
 
     // Apply the initial Q
     Zero( A );
-    auto ATop = A.Matrix()( IR(0,n), IR(0,n) );
-    ATop = ZHalf;
+    auto& ALoc = static_cast<Matrix<F>&>( A.Matrix() );
+    auto ATop = ALoc( IR(0,n), IR(0,n) );
+    Copy( ZHalf, ATop );
 
     // TODO: Exploit sparsity
     ApplyQ
     ( LEFT, NORMAL,
       treeData.QR0, treeData.householderScalars0, treeData.signature0,
-      A.Matrix() );
+      ALoc );
 }
 
 template<typename F>
@@ -273,11 +276,11 @@ FormR( const AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
         const Int n = A.Width();
         auto R = RootQR(A,treeData);
         auto RTop = R( IR(0,n), IR(0,n) );
-        CopyFromRoot( RTop, RRoot );
+        CopyFromRoot( RTop, RRoot, false );
         MakeTrapezoidal( UPPER, RRoot );
     }
     else
-        CopyFromNonRoot( RRoot );
+        CopyFromNonRoot( RRoot, false );
     DistMatrix<F,STAR,STAR> R(g);
     R = RRoot;
     return R;
@@ -293,11 +296,12 @@ FormQ( AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     const Int p = mpi::Size( A.ColComm() );
     if( p == 1 )
     {
-        A.Matrix() = treeData.QR0;
+        auto& ALoc = static_cast<Matrix<F>&>( A.Matrix() );
+        ALoc = treeData.QR0;
         ExpandPackedReflectors
         ( LOWER, VERTICAL, CONJUGATED, 0,
-          A.Matrix(), RootHouseholderScalars(A,treeData) );
-        DiagonalScale( RIGHT, NORMAL, RootSignature(A,treeData), A.Matrix() );
+          ALoc, RootHouseholderScalars(A,treeData) );
+        DiagonalScale( RIGHT, NORMAL, RootSignature(A,treeData), ALoc );
     }
     else
     {
@@ -320,8 +324,10 @@ TreeData<F> TS( const AbstractDistMatrix<F>& A )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("TSQR: Only implemented for CPU matrices.");
     TreeData<F> treeData;
-    treeData.QR0 = A.LockedMatrix();
+    treeData.QR0 = static_cast<const Matrix<F>&>(A.LockedMatrix());
     QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
 
     const Int p = mpi::Size( A.ColComm() );
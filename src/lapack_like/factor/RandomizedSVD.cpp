@@ -0,0 +1,234 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+template<class MatrixType>
+void Sketch( MatrixType& Omega, Int n, Int numCols, RangeFinderSketch sketch )
+{
+    EL_DEBUG_CSE
+    if( sketch == RADEMACHER_SKETCH )
+        Rademacher( Omega, n, numCols );
+    else
+        Gaussian( Omega, n, numCols );
+}
+
+// Q should be conformal with A and Omega and Z with A^H
+template<typename Field,class MatrixType>
+void FindRange
+( const MatrixType& A, MatrixType& Q, MatrixType& Omega, MatrixType& Z,
+  Int numCols, const RangeFinderCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( numCols < 0 || numCols > Min(m,n) )
+        LogicError("Number of columns must be in [0,min(m,n)]");
+    if( ctrl.numPowerIts < 0 )
+        LogicError("Number of power iterations must be non-negative");
+
+    Sketch( Omega, n, numCols, ctrl.sketch );
+    Gemm( NORMAL, NORMAL, Field(1), A, Omega, Q );
+    qr::ExplicitUnitary( Q );
+
+    // Without re-orthonormalization, the columns of (A A^H)^q A Omega would
+    // collapse onto the leading singular vector
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), A, Q, Z );
+        qr::ExplicitUnitary( Z );
+        Gemm( NORMAL, NORMAL, Field(1), A, Z, Q );
+        qr::ExplicitUnitary( Q );
+    }
+}
+
+// Computes C = W diag(s) X^H for a small square C, which is overwritten
+template<typename Field>
+void SmallSVD
+( Matrix<Field>& C,
+  Matrix<Field>& W,
+  Matrix<Base<Field>>& s,
+  Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = C.Height();
+    Matrix<Field> XAdj( n, n );
+    W.Resize( n, n );
+    s.Resize( n, 1 );
+    lapack::QRSVD
+    ( n, n, C.Buffer(), C.LDim(), s.Buffer(),
+      W.Buffer(), W.LDim(), XAdj.Buffer(), XAdj.LDim() );
+    Adjoint( XAdj, X );
+}
+
+void CheckRank( Int m, Int n, Int rank, Int oversample )
+{
+    if( rank < 1 || rank > Min(m,n) )
+        LogicError("Rank must be in [1,min(m,n)]");
+    if( oversample < 0 )
+        LogicError("Oversampling must be non-negative");
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void RangeFinder
+( const Matrix<Field>& A,
+        Matrix<Field>& Q,
+        Int numCols,
+  const RangeFinderCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> Omega, Z;
+    FindRange<Field>( A, Q, Omega, Z, numCols, ctrl );
+}
+
+template<typename Field>
+void RangeFinder
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& QPre,
+        Int numCols,
+  const RangeFinderCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, QPre ))
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> QProx( QPre );
+    auto& A = AProx.GetLocked();
+    auto& Q = QProx.Get();
+
+    const Grid& g = A.Grid();
+    DistMatrix<Field> Omega(g), Z(g);
+    FindRange<Field>( A, Q, Omega, Z, numCols, ctrl );
+}
+
+// With A ~= Q Q^H A = Q B^H and B = Q2 R, we have A ~= (Q W) diag(s) (Q2 X)^H,
+// where R^H = W diag(s) X^H is only (rank+oversample) x (rank+oversample)
+template<typename Field>
+void RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+        Int oversample,
+  const RangeFinderCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    CheckRank( m, n, rank, oversample );
+    const Int numCols = Min( rank+oversample, Min(m,n) );
+
+    Matrix<Field> Q, B, R;
+    RangeFinder( A, Q, numCols, ctrl );
+    Gemm( ADJOINT, NORMAL, Field(1), A, Q, B );
+    qr::Explicit( B, R );
+
+    Matrix<Field> C, W, X;
+    Matrix<Real> sSketch;
+    Adjoint( R, C );
+    SmallSVD( C, W, sSketch, X );
+
+    const Range<Int> indRank( 0, rank );
+    Gemm( NORMAL, NORMAL, Field(1), Q, W(ALL,indRank), U );
+    Gemm( NORMAL, NORMAL, Field(1), B, X(ALL,indRank), V );
+    Copy( sSketch(indRank,ALL), s );
+}
+
+template<typename Field>
+void RandomizedSVD
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+        Int rank,
+        Int oversample,
+  const RangeFinderCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, U, s, V ))
+    typedef Base<Field> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    CheckRank( m, n, rank, oversample );
+    const Int numCols = Min( rank+oversample, Min(m,n) );
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<Field> Q(g), B(g), R(g);
+    RangeFinder( A, Q, numCols, ctrl );
+    Gemm( ADJOINT, NORMAL, Field(1), A, Q, B );
+    qr::Explicit( B, R );
+
+    // Every process redundantly computes the SVD of the small factor
+    DistMatrix<Field,STAR,STAR> R_STAR_STAR( R );
+    Matrix<Field> C, W, X;
+    Matrix<Real> sSketch;
+    Adjoint( R_STAR_STAR.LockedMatrix(), C );
+    SmallSVD( C, W, sSketch, X );
+
+    const Range<Int> indRank( 0, rank );
+    DistMatrix<Field,STAR,STAR> W_STAR_STAR(g), X_STAR_STAR(g);
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR(g);
+    W_STAR_STAR.Resize( numCols, rank );
+    X_STAR_STAR.Resize( numCols, rank );
+    s_STAR_STAR.Resize( rank, 1 );
+    Copy( W(ALL,indRank), W_STAR_STAR.Matrix() );
+    Copy( X(ALL,indRank), X_STAR_STAR.Matrix() );
+    Copy( sSketch(indRank,ALL), s_STAR_STAR.Matrix() );
+
+    DistMatrix<Field,VC,STAR> Q_VC_STAR( Q ), B_VC_STAR( B ),
+                              U_VC_STAR(g), V_VC_STAR(g);
+    LocalGemm( NORMAL, NORMAL, Field(1), Q_VC_STAR, W_STAR_STAR, U_VC_STAR );
+    LocalGemm( NORMAL, NORMAL, Field(1), B_VC_STAR, X_STAR_STAR, V_VC_STAR );
+    Copy( U_VC_STAR, U );
+    Copy( V_VC_STAR, V );
+    Copy( s_STAR_STAR, s );
+}
+
+#define PROTO(Field) \
+  template void RangeFinder \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& Q, \
+          Int numCols, \
+    const RangeFinderCtrl& ctrl ); \
+  template void RangeFinder \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& Q, \
+          Int numCols, \
+    const RangeFinderCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+          Int rank, \
+          Int oversample, \
+    const RangeFinderCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& U, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          AbstractDistMatrix<Field>& V, \
+          Int rank, \
+          Int oversample, \
+    const RangeFinderCtrl& ctrl );
+
+// The SVD of the sketch is computed with LAPACK
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -20,7 +20,7 @@ void PermuteCols
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( A.RowComm() != oldMeta.comm )
+      if( &A.RowComm() != oldMeta.comm )
           LogicError("Invalid communicator in metadata");
       if( A.RowAlign() != oldMeta.align )
           LogicError("Invalid alignment in metadata");
@@ -58,7 +58,7 @@ void PermuteCols
         mpi::AllToAll
         ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
           recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
+          *meta.comm, SyncInfo<Device::CPU>{} );
 
         // Unpack the recv data
         offsets = meta.sendDispls;
@@ -94,7 +94,7 @@ void PermuteCols
         mpi::AllToAll
         ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
           recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
+          *meta.comm, SyncInfo<Device::CPU>{} );
 
         // Unpack the recv data
         offsets = meta.recvDispls;
@@ -117,7 +117,7 @@ void PermuteRows
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( A.ColComm() != oldMeta.comm )
+      if( &A.ColComm() != oldMeta.comm )
           LogicError("Invalid communicator in metadata");
       if( A.ColAlign() != oldMeta.align )
           LogicError("Invalid alignment in metadata");
@@ -157,7 +157,7 @@ void PermuteRows
         mpi::AllToAll
         ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
           recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
+          *meta.comm, SyncInfo<Device::CPU>{} );
 
         // Unpack the recv data
         offsets = meta.sendDispls;
@@ -196,7 +196,7 @@ void PermuteRows
         mpi::AllToAll
         ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
           recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
+          *meta.comm, SyncInfo<Device::CPU>{} );
 
         // Unpack the recv data
         offsets = meta.recvDispls;
@@ -243,7 +243,8 @@ void InvertPermutation
     )
 
     // Compute the send counts
-    const mpi::Comm colComm = p.ColComm();
+    const mpi::Comm& colComm = p.ColComm();
+    SyncInfo<Device::CPU> syncInfo;
     const Int commSize = mpi::Size( colComm );
     vector<int> sendSizes(commSize,0), recvSizes(commSize,0);
     for( Int iLoc=0; iLoc<p.LocalHeight(); ++iLoc )
@@ -253,7 +254,8 @@ void InvertPermutation
         sendSizes[owner] += 2; // we'll send the global index and the value
     }
     // Perform a small AllToAll to get the receive counts
-    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, colComm );
+    mpi::AllToAll
+    ( sendSizes.data(), 1, recvSizes.data(), 1, colComm, syncInfo );
     vector<int> sendOffs, recvOffs;
     const int sendTotal = Scan( sendSizes, sendOffs );
     const int recvTotal = Scan( recvSizes, recvOffs );
@@ -274,7 +276,7 @@ void InvertPermutation
     vector<Int> recvBuf(recvTotal);
     mpi::AllToAll
     ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
-      recvBuf.data(), recvSizes.data(), recvOffs.data(), colComm );
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), colComm, syncInfo );
     SwapClear( sendBuf );
     SwapClear( sendSizes );
     SwapClear( sendOffs );
@@ -786,8 +788,8 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
 
         // TODO(poulson): Query/maintain the unordered_map
         const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+        const mpi::Comm& comm = A.RowComm();
+        keyType_ key( align, &comm );
         auto data = colMeta_.find( key );
         if( data == colMeta_.end() )
         {
@@ -865,8 +867,8 @@ void DistPermutation::InversePermuteCols
 
         // TODO(poulson): Query/maintain the unordered_map
         const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+        const mpi::Comm& comm = A.RowComm();
+        keyType_ key( align, &comm );
         auto data = colMeta_.find( key );
         if( data == colMeta_.end() )
         {
@@ -943,8 +945,8 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
 
         // TODO(poulson): Query/maintain the unordered_map
         const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+        const mpi::Comm& comm = A.ColComm();
+        keyType_ key( align, &comm );
         auto data = rowMeta_.find( key );
         if( data == rowMeta_.end() )
         {
@@ -1023,8 +1025,8 @@ void DistPermutation::InversePermuteRows
 
         // TODO(poulson): Query/maintain the unordered_map
         const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+        const mpi::Comm& comm = A.ColComm();
+        keyType_ key( align, &comm );
         auto data = rowMeta_.find( key );
         if( data == rowMeta_.end() )
         {
@@ -1174,11 +1176,13 @@ void DistPermutation::InversePermuteSymmetrically
 void DistPermutation::ExplicitVector( AbstractDistMatrix<Int>& p ) const
 {
     EL_DEBUG_CSE
+    if( p.GetLocalDevice() != Device::CPU )
+        LogicError("ExplicitVector: Only implemented for CPU matrices.");
     p.SetGrid( *grid_ );
     if( swapSequence_ )
     {
         p.Resize( size_, 1 );
-        auto& pLoc = p.Matrix();
+        auto& pLoc = static_cast<Matrix<Int>&>(p.Matrix());
         const Int localHeight = p.LocalHeight();
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
             pLoc(iLoc) = p.GlobalRow(iLoc);
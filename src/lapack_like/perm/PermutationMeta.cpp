@@ -14,11 +14,11 @@ PermutationMeta::PermutationMeta
 ( const DistMatrix<Int,STAR,STAR>& perm,
   const DistMatrix<Int,STAR,STAR>& invPerm,
         Int permAlign,
-        mpi::Comm permComm )
+  const mpi::Comm& permComm )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(AssertSameGrids( perm, invPerm ))
-    comm = permComm;
+    comm = &permComm;
     align = permAlign;
     const Int permStride = mpi::Size( permComm );
     const Int permShift = Shift( mpi::Rank(permComm), permAlign, permStride );
@@ -51,6 +51,8 @@ template<typename Ring>
 Base<Ring> InfinityNorm( const AbstractDistMatrix<Ring>& A )
 {
     EL_DEBUG_CSE
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("InfinityNorm: Only implemented for CPU matrices.");
     // Compute the partial row sums defined by our local matrix, A[U,V]
     typedef Base<Ring> Real;
 
@@ -59,7 +61,7 @@ Base<Ring> InfinityNorm( const AbstractDistMatrix<Ring>& A )
     {
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
-        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        const auto& ALoc = static_cast<const Matrix<Ring>&>(A.LockedMatrix());
 
         vector<Real> myPartialRowSums( localHeight );
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
@@ -72,7 +74,8 @@ Base<Ring> InfinityNorm( const AbstractDistMatrix<Ring>& A )
         // Sum our partial row sums to get the row sums over A[U,* ]
         vector<Real> myRowSums( localHeight );
         mpi::AllReduce
-        ( myPartialRowSums.data(), myRowSums.data(), localHeight, A.RowComm() );
+        ( myPartialRowSums.data(), myRowSums.data(), localHeight, A.RowComm(),
+          SyncInfo<Device::CPU>{} );
 
         // Find the maximum out of the row sums
         Real myMaxRowSum = 0;
@@ -85,9 +88,10 @@ Base<Ring> InfinityNorm( const AbstractDistMatrix<Ring>& A )
         }
 
         // Find the global maximum row sum by searching over the U team
-        norm = mpi::AllReduce( myMaxRowSum, mpi::MAX, A.ColComm() );
+        norm = mpi::AllReduce( myMaxRowSum, mpi::MAX, A.ColComm(),
+                               SyncInfo<Device::CPU>{} );
     }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    mpi::Broadcast( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>{} );
     return norm;
 }
 
@@ -78,6 +78,8 @@ template<typename Ring>
 Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
 {
     EL_DEBUG_CSE
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("OneNorm: Only implemented for CPU matrices.");
     typedef Base<Ring> Real;
     Real norm;
     if( A.Participating() )
@@ -85,7 +87,7 @@ Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
         // Compute the partial column sums defined by our local matrix, A[U,V]
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
-        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        const auto& ALoc = static_cast<const Matrix<Ring>&>(A.LockedMatrix());
 
         vector<Real> myPartialColSums( localWidth );
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
@@ -98,7 +100,8 @@ Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
         // Sum our partial column sums to get the column sums over A[* ,V]
         vector<Real> myColSums( localWidth );
         mpi::AllReduce
-        ( myPartialColSums.data(), myColSums.data(), localWidth, A.ColComm() );
+        ( myPartialColSums.data(), myColSums.data(), localWidth, A.ColComm(),
+          SyncInfo<Device::CPU>{} );
 
         // Find the maximum out of the column sums
         Real myMaxColSum = 0;
@@ -106,9 +109,10 @@ Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
             myMaxColSum = Max( myMaxColSum, myColSums[jLoc] );
 
         // Find the global maximum column sum by searching the row team
-        norm = mpi::AllReduce( myMaxColSum, mpi::MAX, A.RowComm() );
+        norm = mpi::AllReduce( myMaxColSum, mpi::MAX, A.RowComm(),
+                               SyncInfo<Device::CPU>{} );
     }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    mpi::Broadcast( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>{} );
     return norm;
 }
 
@@ -117,6 +121,8 @@ Base<Ring>
 HermitianOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
 {
     EL_DEBUG_CSE
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("HermitianOneNorm: Only implemented for CPU matrices.");
     typedef Base<Ring> Real;
     if( A.Height() != A.Width() )
         RuntimeError("Hermitian matrices must be square.");
@@ -131,7 +137,7 @@ HermitianOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
     {
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
-        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        const auto& ALoc = static_cast<const Matrix<Ring>&>(A.LockedMatrix());
 
         if( uplo == UPPER )
         {
@@ -170,7 +176,8 @@ HermitianOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
             }
             vector<Real> colSums( height );
             mpi::AllReduce
-            ( partialColSums.data(), colSums.data(), height, A.DistComm() );
+            ( partialColSums.data(), colSums.data(), height, A.DistComm(),
+              SyncInfo<Device::CPU>{} );
 
             // Find the maximum sum
             for( Int j=0; j<height; ++j )
@@ -213,14 +220,16 @@ HermitianOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
             }
             vector<Real> colSums( height );
             mpi::AllReduce
-            ( partialColSums.data(), colSums.data(), height, A.DistComm() );
+            ( partialColSums.data(), colSums.data(), height, A.DistComm(),
+              SyncInfo<Device::CPU>{} );
 
             // Find the maximum sum
             for( Int j=0; j<height; ++j )
                 maxColSum = Max( maxColSum, colSums[j] );
         }
     }
-    mpi::Broadcast( maxColSum, A.Root(), A.CrossComm() );
+    mpi::Broadcast
+    ( maxColSum, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>{} );
     return maxColSum;
 }
 
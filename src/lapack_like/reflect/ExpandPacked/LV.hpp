@@ -243,8 +243,8 @@ LV
 
     // Take care of any untouched columns on the left side of H
     const Int oldEffectedWidth = oldEffectedHeight - mRem;
-    HEffectedNew = H( ALL, IR(0,n-oldEffectedWidth) );
-    MakeIdentity( HEffectedNew );
+    auto HUntouched = H( ALL, IR(0,n-oldEffectedWidth) );
+    MakeIdentity( HUntouched );
 }
 
 } // namespace expand_packed_reflectors
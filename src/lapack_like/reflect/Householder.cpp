@@ -80,9 +80,11 @@ F LeftReflector( AbstractDistMatrix<F>& chi, AbstractDistMatrix<F>& x )
     {
         if( x.RowRank() == x.RowAlign() )
             tau = reflector::Col( chi, x );
-        mpi::Broadcast( tau, x.RowAlign(), x.RowComm() );
+        mpi::Broadcast
+        ( tau, x.RowAlign(), x.RowComm(), SyncInfo<Device::CPU>{} );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast
+    ( tau, x.Root(), x.CrossComm(), SyncInfo<Device::CPU>{} );
     return tau;
 }
 
@@ -99,9 +101,11 @@ F LeftReflector( F& chi, AbstractDistMatrix<F>& x )
     {
         if( x.RowRank() == x.RowAlign() )
             tau = reflector::Col( chi, x );
-        mpi::Broadcast( tau, x.RowAlign(), x.RowComm() );
+        mpi::Broadcast
+        ( tau, x.RowAlign(), x.RowComm(), SyncInfo<Device::CPU>{} );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast
+    ( tau, x.Root(), x.CrossComm(), SyncInfo<Device::CPU>{} );
     return tau;
 }
 
@@ -161,9 +165,11 @@ F RightReflector( AbstractDistMatrix<F>& chi, AbstractDistMatrix<F>& x )
     {
         if( x.ColRank() == x.ColAlign() )
             tau = reflector::Row( chi, x );
-        mpi::Broadcast( tau, x.ColAlign(), x.ColComm() );
+        mpi::Broadcast
+        ( tau, x.ColAlign(), x.ColComm(), SyncInfo<Device::CPU>{} );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast
+    ( tau, x.Root(), x.CrossComm(), SyncInfo<Device::CPU>{} );
     return tau;
 }
 
@@ -180,9 +186,11 @@ F RightReflector( F& chi, AbstractDistMatrix<F>& x )
     {
         if( x.ColRank() == x.ColAlign() )
             tau = reflector::Row( chi, x );
-        mpi::Broadcast( tau, x.ColAlign(), x.ColComm() );
+        mpi::Broadcast
+        ( tau, x.ColAlign(), x.ColComm(), SyncInfo<Device::CPU>{} );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast
+    ( tau, x.Root(), x.CrossComm(), SyncInfo<Device::CPU>{} );
     return tau;
 }
 
@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// The precision in which the factorization is computed
+template<typename Field> struct LowerPrecision;
+template<> struct LowerPrecision<double> { typedef float type; };
+template<> struct LowerPrecision<Complex<double>>
+{ typedef Complex<float> type; };
+
+template<typename Field,class MatrixType>
+void CholeskySolve( UpperOrLower uplo, const MatrixType& L, MatrixType& B )
+{
+    EL_DEBUG_CSE
+    if( uplo == LOWER )
+    {
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), L, B );
+        Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Field(1), L, B );
+    }
+    else
+    {
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), L, B );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), L, B );
+    }
+}
+
+// Whether every entry of A can be rounded to the lower precision without
+// overflowing, as checked by LAPACK's dlag2s before dsposv narrows
+template<typename Field,class MatrixType>
+bool FitsLowerPrecision( const MatrixType& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<typename LowerPrecision<Field>::type> RealLow;
+    return MaxAbs( A ) <= Base<Field>(limits::Max<RealLow>());
+}
+
+// Overwrites R with B - A X and returns the normwise backward error of X
+template<typename Field,class MatrixType>
+Base<Field> Residual
+( const MatrixType& A, const MatrixType& B, const MatrixType& X,
+  MatrixType& R, Base<Field> ANorm, Base<Field> BNorm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    R = B;
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    const Real denom = ANorm*FrobeniusNorm(X) + BNorm;
+    return denom == Real(0) ? Real(0) : FrobeniusNorm(R) / denom;
+}
+
+// AHerm should hold all of A, X and R should be conformal with B, and ALow
+// and RLow should be conformal with AHerm and B but in the lower precision.
+// B is overwritten with the solution.
+template<typename Field,class MatrixType,class LowMatrixType>
+MixedPrecisionHPDSolveInfo<Base<Field>> Refine
+( UpperOrLower uplo,
+  MatrixType& AHerm, MatrixType& B,
+  MatrixType& X, MatrixType& R,
+  LowMatrixType& ALow, LowMatrixType& RLow,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef typename LowerPrecision<Field>::type FieldLow;
+    MixedPrecisionHPDSolveInfo<Real> info;
+    const Int n = AHerm.Height();
+    const Real relTol =
+      ( ctrl.relTol > Real(0) ? ctrl.relTol
+                              : Sqrt(Real(n))*limits::Epsilon<Real>() );
+    const Real ANorm = FrobeniusNorm( AHerm );
+    const Real BNorm = FrobeniusNorm( B );
+
+    bool factored = false;
+    if( FitsLowerPrecision<Field>( AHerm ) && FitsLowerPrecision<Field>( B ) )
+    {
+        factored = true;
+        Copy( AHerm, ALow );
+        try { Cholesky( uplo, ALow ); }
+        catch( NonHPDMatrixException& ) { factored = false; }
+    }
+
+    if( factored )
+    {
+        Copy( B, RLow );
+        CholeskySolve<FieldLow>( uplo, ALow, RLow );
+        Copy( RLow, X );
+
+        Real lastError = limits::Infinity<Real>();
+        while( true )
+        {
+            info.backwardError =
+              Residual<Field>( AHerm, B, X, R, ANorm, BNorm );
+            // The single-precision solve overflowed or broke down
+            if( !limits::IsFinite( info.backwardError ) )
+                break;
+            if( info.backwardError <= relTol )
+            {
+                info.converged = true;
+                break;
+            }
+            if( info.numRefineIts >= ctrl.maxRefineIts ||
+                info.backwardError > ctrl.stallRatio*lastError ||
+                !FitsLowerPrecision<Field>( R ) )
+                break;
+            lastError = info.backwardError;
+
+            Copy( R, RLow );
+            CholeskySolve<FieldLow>( uplo, ALow, RLow );
+            Copy( RLow, R );
+            Axpy( Field(1), R, X );
+            ++info.numRefineIts;
+        }
+    }
+
+    if( !info.converged && ctrl.fallback )
+    {
+        // AHerm is still needed to form the final residual
+        MatrixType AFact( AHerm );
+        Cholesky( uplo, AFact );
+        X = B;
+        CholeskySolve<Field>( uplo, AFact, X );
+        info.backwardError = Residual<Field>( AHerm, B, X, R, ANorm, BNorm );
+        info.converged = ( info.backwardError <= relTol );
+        info.usedFallback = true;
+    }
+
+    B = X;
+    return info;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+MixedPrecisionHPDSolveInfo<Base<Field>> MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must be the same height");
+    typedef typename LowerPrecision<Field>::type FieldLow;
+
+    Matrix<Field> AHerm( A );
+    MakeHermitian( uplo, AHerm );
+    Matrix<Field> X, R;
+    Matrix<FieldLow> ALow, RLow;
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    auto info = Refine<Field>( uplo, AHerm, B, X, R, ALow, RLow, ctrl );
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    return info;
+}
+
+template<typename Field>
+MixedPrecisionHPDSolveInfo<Base<Field>> MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( A, BPre ))
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != BPre.Height() )
+        LogicError("A and B must be the same height");
+    typedef typename LowerPrecision<Field>::type FieldLow;
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    const Grid& g = A.Grid();
+    DistMatrix<Field> AHerm( A );
+    MakeHermitian( uplo, AHerm );
+    DistMatrix<Field> X(g), R(g);
+    DistMatrix<FieldLow> ALow(g), RLow(g);
+    X.AlignWith( B );
+    R.AlignWith( B );
+    ALow.AlignWith( AHerm );
+    RLow.AlignWith( B );
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    auto info = Refine<Field>( uplo, AHerm, B, X, R, ALow, RLow, ctrl );
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    return info;
+}
+
+#define PROTO(Field) \
+  template MixedPrecisionHPDSolveInfo<Base<Field>> MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Matrix<Field>& A, Matrix<Field>& B, \
+    const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl ); \
+  template MixedPrecisionHPDSolveInfo<Base<Field>> MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl );
+
+// Only the double-precision types have a lower precision to factor in
+PROTO(double)
+PROTO(Complex<double>)
+
+} // namespace El
@@ -47,10 +47,33 @@ void MakeGaussian(AbstractMatrix<F>& A, F mean, Base<F> stddev)
     }
 }
 
+namespace {
+
+// See MakeUniformPhilox
+template<typename F,typename=EnableIf<IsPhiloxSampleable<F>>>
+bool MakeGaussianPhilox( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    if( A.GetLocalDevice() != Device::CPU )
+        return false;
+    const PhiloxKey key = NewPhiloxKey( A.Grid() );
+    IndexDependentFill
+    ( A, [=]( Int i, Int j )
+         { return SamplePhiloxNormal(mean,stddev,PhiloxBits(key,i,j)); } );
+    return true;
+}
+
+template<typename F,typename=DisableIf<IsPhiloxSampleable<F>>,typename=void>
+bool MakeGaussianPhilox( AbstractDistMatrix<F>&, F, Base<F> )
+{ return false; }
+
+} // anonymous namespace
+
 template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if( MakeGaussianPhilox( A, mean, stddev ) )
+        return;
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -49,10 +49,35 @@ void Uniform( AbstractMatrix<T>& A, Int m, Int n, T center, Base<T> radius )
     MakeUniform( A, center, radius );
 }
 
+namespace {
+
+// Fill the local entries of A from a fresh counter-based stream indexed by the
+// global (i,j). Nothing is communicated, and the matrix is the same for any
+// distribution. Returns false if the type or device is unsupported.
+template<typename T,typename=EnableIf<IsPhiloxSampleable<T>>>
+bool MakeUniformPhilox( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    if( A.GetLocalDevice() != Device::CPU )
+        return false;
+    const PhiloxKey key = NewPhiloxKey( A.Grid() );
+    IndexDependentFill
+    ( A, [=]( Int i, Int j )
+         { return SamplePhiloxBall(center,radius,PhiloxBits(key,i,j)); } );
+    return true;
+}
+
+template<typename T,typename=DisableIf<IsPhiloxSampleable<T>>,typename=void>
+bool MakeUniformPhilox( AbstractDistMatrix<T>&, T, Base<T> )
+{ return false; }
+
+} // anonymous namespace
+
 template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if( MakeUniformPhilox( A, center, radius ) )
+        return;
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -92,6 +92,115 @@ void TestEntrywiseMap
     PopIndent();
 }
 
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A, const Matrix<T>& ref, const string& label )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    const auto& ALoc = A_STAR_STAR.LockedMatrix();
+    if( ALoc.Height() != ref.Height() || ALoc.Width() != ref.Width() )
+        LogicError
+        (label,": result was ",ALoc.Height()," x ",ALoc.Width(),
+         " instead of ",ref.Height()," x ",ref.Width());
+    for( Int j=0; j<ref.Width(); ++j )
+        for( Int i=0; i<ref.Height(); ++i )
+            if( ALoc(i,j) != ref(i,j) )
+                LogicError
+                (label,": entry (",i,",",j,") was ",ALoc(i,j),
+                 " instead of ",ref(i,j));
+}
+
+// C := A .* B + A through the fused map, with B in distribution [U,V]
+// (possibly misaligned with A) so that it must be redistributed
+template<typename T,Dist U,Dist V,typename AMatrix>
+void TestFusedMap
+( const AMatrix& A, const Matrix<T>& ALoc, const Matrix<T>& BLoc,
+  Int colAlign, Int rowAlign )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,STAR,STAR> B_STAR_STAR(g);
+    B_STAR_STAR.Resize( BLoc.Height(), BLoc.Width() );
+    B_STAR_STAR.Matrix() = BLoc;
+    DistMatrix<T,U,V> B(g);
+    B.Align( Mod(colAlign,B.ColStride()), Mod(rowAlign,B.RowStride()) );
+    Copy( B_STAR_STAR, B );
+
+    Matrix<T> ref;
+    EntrywiseMap
+    ( ALoc, BLoc, ref, []( const T& alpha, const T& beta )
+      { return alpha*beta + alpha; } );
+
+    AMatrix C(g);
+    EntrywiseMap
+    ( A, B, C, []( const T& alpha, const T& beta )
+      { return alpha*beta + alpha; } );
+    CheckEqual
+    ( C, ref,
+      BuildString
+      ("Fused map of [",DistToString(A.ColDist()),",",
+       DistToString(A.RowDist()),"] and [",DistToString(U),",",
+       DistToString(V),"] aligned at (",B.ColAlign(),",",B.RowAlign(),")") );
+}
+
+// Checks the callable and fused overloads against the equivalent sequential
+// computation on every process
+template<typename T>
+void TestOverloads( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing overloads with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR(g);
+    Uniform( B_STAR_STAR, m, n );
+    const Matrix<T> ALoc = A_STAR_STAR.Matrix();
+    const Matrix<T> BLoc = B_STAR_STAR.Matrix();
+
+    // In-place map by a lambda and by a std::function
+    auto square = []( const T& alpha ) { return alpha*alpha; };
+    Matrix<T> ref( ALoc );
+    EntrywiseMap( ref, square );
+    DistMatrix<T> ASquared( A );
+    EntrywiseMap( ASquared, square );
+    CheckEqual( ASquared, ref, "In-place map by a lambda" );
+    ASquared = A;
+    EntrywiseMap( ASquared, function<T(const T&)>(square) );
+    CheckEqual( ASquared, ref, "In-place map by a std::function" );
+
+    // Out-of-place map into another distribution by a lambda
+    DistMatrix<T,VC,STAR> ASquared_VC_STAR(g);
+    EntrywiseMap( A, ASquared_VC_STAR, square );
+    CheckEqual( ASquared_VC_STAR, ref, "Map from [MC,MR] to [VC,* ]" );
+
+    // The fused map with B already distributed like A, with B redistributed
+    // from other distributions or alignments, and with A not in [MC,MR]
+    TestFusedMap<T,MC,  MR  >( A, ALoc, BLoc, 0, 0 );
+    TestFusedMap<T,MC,  MR  >( A, ALoc, BLoc, 1, 1 );
+    TestFusedMap<T,MR,  MC  >( A, ALoc, BLoc, 0, 0 );
+    TestFusedMap<T,VC,  STAR>( A, ALoc, BLoc, 0, 0 );
+    TestFusedMap<T,STAR,STAR>( A, ALoc, BLoc, 0, 0 );
+    DistMatrix<T,VC,STAR> A_VC_STAR( A );
+    TestFusedMap<T,VC,  STAR>( A_VC_STAR, ALoc, BLoc, 0, 0 );
+    TestFusedMap<T,MC,  MR  >( A_VC_STAR, ALoc, BLoc, 0, 0 );
+    TestFusedMap<T,STAR,VR  >( A_VC_STAR, ALoc, BLoc, 0, 0 );
+
+    // C must already share the distribution of A
+    bool caught = false;
+    try
+    {
+        DistMatrix<T,STAR,STAR> C(g);
+        EntrywiseMap
+        ( A, A, C, []( const T& alpha, const T& beta )
+          { return alpha+beta; } );
+    }
+    catch( std::exception& ) { caught = true; }
+    if( !caught )
+        LogicError("The fused map accepted C distributed unlike A");
+
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -163,6 +272,9 @@ main( int argc, char* argv[] )
         }
 
         // Run tests
+        TestOverloads<float>( m, n, g );
+        TestOverloads<double>( m, n, g );
+        TestOverloads<Complex<double>>( m, n, g );
         TestEntrywiseMap<float>( m, n, funcFloat, numThreads, g, print );
         TestEntrywiseMap<Complex<float>>( m, n, funcComplexFloat, numThreads, g, print );
         TestEntrywiseMap<double>( m, n, funcDouble, numThreads, g, print );
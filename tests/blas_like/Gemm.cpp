@@ -194,6 +194,91 @@ void TestGemm
         flush(std::cout);
     }
 
+    // Test the variant of Gemm selected by the cost model
+    {
+        C = COrig;
+        const GemmAlgorithm alg =
+            DefaultGemmAlgorithm(orientA, orientB, A, B, C);
+        OutputFromRoot(g.Comm(),"Default algorithm (",int(alg),"):");
+        PushIndent();
+        timer.Reset();
+        mpi::Barrier(g.Comm());
+        timer.Start();
+        Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_DEFAULT);
+        mpi::Barrier(g.Comm());
+        timer.Stop();
+        runTime = timer.GetTime();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+        OutputFromRoot(
+            g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+
+        if (print)
+            Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+        if (correctness)
+            TestAssociativity
+                (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+        PopIndent();
+
+        flush(std::cout);
+    }
+
+    // Test the (generalized) Cannon algorithm
+    if (D == Device::CPU)
+    {
+        C = COrig;
+        OutputFromRoot(g.Comm(),"Cannon Algorithm:");
+        PushIndent();
+        timer.Reset();
+        mpi::Barrier(g.Comm());
+        timer.Start();
+        Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_CANNON);
+        mpi::Barrier(g.Comm());
+        timer.Stop();
+        runTime = timer.GetTime();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+        OutputFromRoot(
+            g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+
+        if (print)
+            Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+        if (correctness)
+            TestAssociativity
+                (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+        PopIndent();
+
+        flush(std::cout);
+    }
+
+    // Test the 2.5D algorithm over replicated layers of the grid
+    if (D == Device::CPU)
+    {
+        C = COrig;
+        OutputFromRoot(g.Comm(),"3D Algorithm:");
+        PushIndent();
+        timer.Reset();
+        mpi::Barrier(g.Comm());
+        timer.Start();
+        Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_3D);
+        mpi::Barrier(g.Comm());
+        timer.Stop();
+        runTime = timer.GetTime();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+        OutputFromRoot(
+            g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+
+        if (print)
+            Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+        if (correctness)
+            TestAssociativity
+                (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+        PopIndent();
+
+        flush(std::cout);
+    }
+
     if (orientA == NORMAL && orientB == NORMAL)
     {
         for (int ii = 0; ii < 0; ++ii)
@@ -256,6 +341,10 @@ main(int argc, char* argv[])
         const Int rowAlignC = Input("--rowAlignC","row align of C",0);
         const bool testCPU = El::Input("--testCPU", "test CPU gemm?", true);
         const bool testGPU = El::Input("--testGPU", "test GPU gemm?", false);
+        const bool pipeline =
+            Input("--pipeline","overlap SUMMA communication?",false);
+        const Int numLayers =
+            Input("--layers","number of GEMM_3D layers (0 for default)",0);
 
         ProcessInput();
         PrintInputReport();
@@ -267,6 +356,8 @@ main(int argc, char* argv[])
         const Orientation orientA = CharToOrientation(transA);
         const Orientation orientB = CharToOrientation(transB);
         SetBlocksize(nb);
+        SetGemmPipelining(pipeline);
+        SetGemm3DReplication(numLayers);
 
         ComplainIfDebug();
         OutputFromRoot(g.Comm(),"Will test Gemm",transA,transB);
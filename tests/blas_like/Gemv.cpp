@@ -51,6 +51,49 @@ void TestGemv
     PopIndent();
 }
 
+template<typename T>
+void TestGemvPlan
+(Orientation orientA,
+ Int m,
+ Int numIts,
+ T alpha,
+ T beta,
+ const Grid& g)
+{
+    OutputFromRoot(g.Comm(),"Testing GemvPlan with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T> A(g), yRef(g);
+    DistMatrix<T,VC,STAR> x(g), y(g);
+    Uniform(A, m, m);
+    Uniform(x, m, 1);
+    Uniform(y, m, 1);
+    yRef = y;
+
+    GemvPlan<T> plan(orientA, A, x, y);
+    mpi::Barrier(g.Comm());
+    Timer timer;
+    timer.Start();
+    for (Int it=0; it<numIts; ++it)
+        plan.Apply(alpha, x, beta, y);
+    mpi::Barrier(g.Comm());
+    const double runTime = timer.Stop();
+    OutputFromRoot
+    (g.Comm(),"Finished ",numIts," applications in ",runTime," seconds");
+
+    for (Int it=0; it<numIts; ++it)
+        Gemv(orientA, alpha, A, x, beta, yRef);
+    DistMatrix<T> E(g);
+    E = y;
+    E -= yRef;
+    const Base<T> relError = FrobeniusNorm(E) / FrobeniusNorm(yRef);
+    OutputFromRoot(g.Comm(),"|| y - yRef ||_F / || yRef ||_F = ",relError);
+    if (relError > Base<T>(numIts*m)*limits::Epsilon<Base<T>>())
+        LogicError("GemvPlan disagreed with Gemv");
+
+    PopIndent();
+}
+
 int
 main(int argc, char* argv[])
 {
@@ -64,6 +107,8 @@ main(int argc, char* argv[])
         const char transA = Input("--transA","orientation of A: N/T/C",'N');
         const Int m = Input("--m","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int numIts =
+          Input("--numIts","number of GemvPlan applications",10);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -108,6 +153,11 @@ main(int argc, char* argv[])
           Complex<double>(3), Complex<double>(4),
           print, g);
 
+        TestGemvPlan<float>(orientA, m, numIts, float(3), float(4), g);
+        TestGemvPlan<Complex<double>>
+        (orientA, m, numIts,
+          Complex<double>(3), Complex<double>(4), g);
+
 #ifdef EL_HAVE_QD
         TestGemv<DoubleDouble>
         (orientA, m,
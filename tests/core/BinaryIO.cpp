@@ -0,0 +1,151 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckIdentical
+( const AbstractDistMatrix<T>& A, const Matrix<T>& ref, const string& label )
+{
+    if( A.Height() != ref.Height() || A.Width() != ref.Width() )
+        LogicError
+        (label,": read a ",A.Height()," x ",A.Width()," matrix instead of a ",
+         ref.Height()," x ",ref.Width()," one");
+    // Copying a block matrix into an elemental one is not yet supported
+    Matrix<T> ALoc;
+    if( A.Wrap() == BLOCK )
+    {
+        DistMatrix<T,STAR,STAR,BLOCK> A_STAR_STAR( A );
+        ALoc = A_STAR_STAR.LockedMatrix();
+    }
+    else
+    {
+        DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+        ALoc = A_STAR_STAR.LockedMatrix();
+    }
+    for( Int j=0; j<ref.Width(); ++j )
+        for( Int i=0; i<ref.Height(); ++i )
+            if( ALoc(i,j) != ref(i,j) )
+                LogicError
+                (label,": entry (",i,",",j,") was ",ALoc(i,j),
+                 " instead of ",ref(i,j));
+}
+
+// Writes the reference matrix from one distribution and reads it back into
+// another, so that the file layout cannot depend on the writer's
+template<typename T,typename WriteMatrix,typename ReadMatrix>
+void RoundTrip
+( const Grid& g, const Matrix<T>& ref, FileFormat format,
+  const string& basename )
+{
+    WriteMatrix A(g);
+    ReadMatrix B(g);
+    const string label =
+      BuildString
+      (FileExtension(format)," from [",DistToString(A.ColDist()),",",
+       DistToString(A.RowDist()),"] to [",DistToString(B.ColDist()),",",
+       DistToString(B.RowDist()),"]",
+       (A.Wrap() == BLOCK || B.Wrap() == BLOCK ? " with blocks" : "")," on a ",
+       g.Height()," x ",g.Width()," grid");
+
+    DistMatrix<T,STAR,STAR> ref_STAR_STAR(g);
+    ref_STAR_STAR.Resize( ref.Height(), ref.Width() );
+    ref_STAR_STAR.Matrix() = ref;
+    // Copy does not yet redistribute from an elemental to a block matrix
+    A = ref_STAR_STAR;
+
+    Write( A, basename, format );
+    if( format == BINARY_FLAT )
+        B.Resize( ref.Height(), ref.Width() );
+    Read( B, basename+"."+FileExtension(format), format );
+    CheckIdentical( B, ref, label );
+}
+
+template<typename T>
+void TestFormat
+( const Grid& g, const Matrix<T>& ref, FileFormat format,
+  const string& basename )
+{
+    typedef DistMatrix<T,MC,  MR  > MC_MR;
+    typedef DistMatrix<T,MR,  MC  > MR_MC;
+    typedef DistMatrix<T,VC,  STAR> VC_STAR;
+    typedef DistMatrix<T,STAR,VR  > STAR_VR;
+    typedef DistMatrix<T,MC,  STAR> MC_STAR;
+    typedef DistMatrix<T,STAR,STAR> STAR_STAR;
+    typedef DistMatrix<T,CIRC,CIRC> CIRC_CIRC;
+    typedef DistMatrix<T,MC,  MR,  BLOCK> MC_MR_BLOCK;
+    typedef DistMatrix<T,STAR,VR,  BLOCK> STAR_VR_BLOCK;
+
+    RoundTrip<T,MC_MR,    MC_MR    >( g, ref, format, basename );
+    RoundTrip<T,MC_MR,    MR_MC    >( g, ref, format, basename );
+    RoundTrip<T,VC_STAR,  STAR_VR  >( g, ref, format, basename );
+    RoundTrip<T,MC_STAR,  STAR_STAR>( g, ref, format, basename );
+    RoundTrip<T,STAR_STAR,MC_STAR  >( g, ref, format, basename );
+    RoundTrip<T,CIRC_CIRC,MC_MR    >( g, ref, format, basename );
+    RoundTrip<T,MC_MR,    MC_MR_BLOCK  >( g, ref, format, basename );
+    RoundTrip<T,MC_MR_BLOCK,STAR_VR_BLOCK>( g, ref, format, basename );
+}
+
+template<typename T>
+void TestBinaryIO( Int m, Int n )
+{
+    mpi::Comm const& comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    PushIndent();
+
+    // Every entry is distinct so that misplaced entries are caught
+    Matrix<T> ref( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            ref(i,j) = T(i+j*m+1);
+
+    const string basename = "BinaryIOTest";
+    for( int height=1; height<=commSize; ++height )
+    {
+        if( commSize % height != 0 )
+            continue;
+        const Grid g( mpi::NewWorldComm(), height );
+        TestFormat( g, ref, BINARY, basename );
+        TestFormat( g, ref, BINARY_FLAT, basename );
+    }
+
+    mpi::Barrier( comm );
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::remove( (basename+"."+FileExtension(BINARY)).c_str() );
+        std::remove( (basename+"."+FileExtension(BINARY_FLAT)).c_str() );
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",23);
+        const Int mb = Input("--mb","block height",5);
+        const Int nb = Input("--nb","block width",3);
+        ProcessInput();
+        PrintInputReport();
+
+        // The block distributions use the default block sizes
+        SetDefaultBlockHeight( mb );
+        SetDefaultBlockWidth( nb );
+        TestBinaryIO<float>( m, n );
+        TestBinaryIO<double>( m, n );
+        TestBinaryIO<Complex<double>>( m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <El/core/Profiling.hpp>
+using namespace El;
+
+const char* commName = "CommStatsTest";
+const char* regionName = "CommStatsRegion";
+
+// Checks the calls and bytes recorded on this rank for an operation over
+// the test communicator within the test region
+void CheckStats
+( const std::vector<CommStats>& stats, const std::string& operation,
+  Int commSize, std::uint64_t calls, std::uint64_t bytes )
+{
+    std::uint64_t foundCalls = 0, foundBytes = 0;
+    for( auto const& s : stats )
+    {
+        if( s.operation != operation || s.comm != commName )
+            continue;
+        if( s.region != regionName )
+            LogicError
+            (operation," was attributed to region \"",s.region,"\"");
+        if( s.commSize != commSize )
+            LogicError
+            (operation," was recorded with a communicator of size ",
+             s.commSize," instead of ",commSize);
+        foundCalls += s.calls;
+        foundBytes += s.bytes;
+    }
+    if( foundCalls != calls || foundBytes != bytes )
+        LogicError
+        (operation,": expected ",calls," calls moving ",bytes," bytes but "
+         "found ",foundCalls," calls moving ",foundBytes," bytes");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm const& worldComm = mpi::COMM_WORLD;
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        mpi::Comm comm;
+        mpi::Dup( worldComm, comm );
+        mpi::SetName( comm, commName );
+        const int commRank = mpi::Rank( comm );
+        const int commSize = mpi::Size( comm );
+        SyncInfo<Device::CPU> syncInfo;
+
+        EnableCommStats();
+        ClearCommStats();
+        BeginRegionProfile( regionName, Color::ROYAL_BLUE );
+
+        // Three all-reduces of five doubles
+        const int reduceCount = 5;
+        vector<double> reduceSend( reduceCount, 1. ),
+                       reduceRecv( reduceCount );
+        for( Int k=0; k<3; ++k )
+            mpi::AllReduce
+            ( reduceSend.data(), reduceRecv.data(), reduceCount, mpi::SUM,
+              comm, syncInfo );
+
+        // One all-gather of four floats from each process
+        const int gatherCount = 4;
+        vector<float> gatherSend( gatherCount, float(commRank) ),
+                      gatherRecv( gatherCount*commSize );
+        mpi::AllGather
+        ( gatherSend.data(), gatherCount, gatherRecv.data(), gatherCount,
+          comm, syncInfo );
+
+        // Seven integers from the first process to the second
+        const int sendCount = 7;
+        vector<Int> message( sendCount, 3 );
+        if( commSize > 1 )
+        {
+            if( commRank == 0 )
+                mpi::Send( message.data(), sendCount, 1, comm, syncInfo );
+            else if( commRank == 1 )
+                mpi::Recv( message.data(), sendCount, 0, comm, syncInfo );
+        }
+
+        EndRegionProfile( regionName );
+
+        // Nothing is recorded once the statistics are disabled
+        DisableCommStats();
+        mpi::AllReduce
+        ( reduceSend.data(), reduceRecv.data(), reduceCount, mpi::SUM,
+          comm, syncInfo );
+
+        const auto stats = GetCommStats();
+        CheckStats
+        ( stats, "AllReduce", commSize, 3, 3*2*sizeof(double)*reduceCount );
+        CheckStats
+        ( stats, "AllGather", commSize, 1,
+          sizeof(float)*(gatherCount+gatherCount*commSize) );
+        const bool sent = ( commSize > 1 && commRank == 0 );
+        const bool received = ( commSize > 1 && commRank == 1 );
+        CheckStats
+        ( stats, "Send", commSize, sent, sent*sizeof(Int)*sendCount );
+        CheckStats
+        ( stats, "Recv", commSize, received,
+          received*sizeof(Int)*sendCount );
+        OutputFromRoot(worldComm,"Recorded counts and volumes are correct");
+
+        std::ostringstream report;
+        PrintCommStatsReport( report );
+        if( mpi::Rank(worldComm) == 0 &&
+            report.str().find(commName) == std::string::npos )
+            LogicError("The report does not list the test communicator");
+
+        mpi::Free( comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -9,6 +9,45 @@
 #include <El.hpp>
 using namespace El;
 
+// Returns 1 if copying B into a matrix distributed and aligned like A through
+// a RedistPlan, twice, or through copy::GeneralPurpose (which caches such a
+// plan on the grid), twice, does not reproduce A
+template<typename T,Dist AColDist,Dist ARowDist,Dist BColDist,Dist BRowDist>
+Int
+CheckPlan(DistMatrix<T,AColDist,ARowDist,ELEMENT,Device::CPU> const& A,
+          DistMatrix<T,BColDist,BRowDist,ELEMENT,Device::CPU> const& B)
+{
+    DistMatrix<T,AColDist,ARowDist,ELEMENT,Device::CPU>
+        APlan(A.Grid(), A.Root());
+    APlan.Align(A.ColAlign(), A.RowAlign());
+    RedistPlan<T> plan(B, APlan);
+    Int errorFlag = 0;
+    for (Int apply=0; apply<4; ++apply)
+    {
+        if (apply < 2)
+            plan.Apply(B, APlan);
+        else
+            copy::GeneralPurpose(B, APlan);
+        auto const& ALoc = A.LockedMatrix();
+        auto const& APlanLoc = APlan.LockedMatrix();
+        for (Int jLoc=0; jLoc<ALoc.Width(); ++jLoc)
+            for (Int iLoc=0; iLoc<ALoc.Height(); ++iLoc)
+                if (APlanLoc.Get(iLoc,jLoc) != ALoc.Get(iLoc,jLoc))
+                    errorFlag = 1;
+        Zero(APlan);
+    }
+    return errorFlag;
+}
+
+template<typename T,Dist AColDist,Dist ARowDist,Dist BColDist,Dist BRowDist,
+         Device ADevice, Device BDevice>
+Int
+CheckPlan(DistMatrix<T,AColDist,ARowDist,ELEMENT,ADevice> const&,
+          DistMatrix<T,BColDist,BRowDist,ELEMENT,BDevice> const&)
+{
+    return 0;
+}
+
 template<typename T,Dist AColDist,Dist ARowDist,Dist BColDist,Dist BRowDist,
          Device ADevice, Device BDevice>
 void
@@ -53,6 +92,8 @@ Check(DistMatrix<T,AColDist,ARowDist,ELEMENT,ADevice>& A,
         if (myErrorFlag != 0)
             break;
     }
+    if (CheckPlan(A, B) != 0)
+        myErrorFlag = 1;
 
     Int summedErrorFlag;
     mpi::AllReduce(&myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm(), cpu_si);
@@ -272,7 +313,7 @@ main(int argc, char* argv[])
     {
         volatile int x = 1;
         while (x) {
-            hydrogen::break_on_me();
+            break_on_me();
         };
     }
 
@@ -0,0 +1,196 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Whether the process of the given rank queues an update of entry (i,j)
+bool Queues( Int i, Int j, int rank )
+{ return (i+2*j+rank) % 3 == 0; }
+
+// Every queuing process sends each of its updates twice so that duplicates
+// must be combined, and the first process also updates every entry so that
+// it needs more rounds than the others
+template<typename T>
+void QueueUpdates( AbstractDistMatrix<T>& A, int rank )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            if( Queues(i,j,rank) )
+            {
+                A.QueueUpdate( i, j, T(rank+1) );
+                A.QueueUpdate( i, j, T(rank+1) );
+            }
+            if( rank == 0 )
+                A.QueueUpdate( i, j, T(1) );
+        }
+}
+
+template<typename T>
+T ExpectedEntry( Int i, Int j, const vector<int>& ranks )
+{
+    T value = 0;
+    for( const int rank : ranks )
+    {
+        if( Queues(i,j,rank) )
+            value += T(2*(rank+1));
+        if( rank == 0 )
+            value += T(1);
+    }
+    return value;
+}
+
+template<typename T,Dist U,Dist V>
+void TestQueues
+( const Grid& g, Int m, Int n, Int roundSize, bool includeViewers )
+{
+    mpi::Comm const& viewingComm = g.ViewingComm();
+    const int viewingRank = mpi::Rank( viewingComm );
+    const int viewingSize = mpi::Size( viewingComm );
+    OutputFromRoot
+    (viewingComm,"Testing [",DistToString(U),",",DistToString(V),"] with ",
+     TypeName<T>(),", rounds of ",roundSize,
+     (includeViewers ? " and viewers" : " and no viewers"));
+
+    DistMatrix<T,U,V> A(g);
+    Zeros( A, m, n );
+
+    // Only the participating processes queue when the viewers are excluded
+    const bool queues = includeViewers || A.Participating();
+    vector<int> queuingRanks;
+    {
+        const int queuesInt = ( queues ? 1 : 0 );
+        vector<int> allQueues(viewingSize);
+        mpi::AllGather
+        ( &queuesInt, 1, allQueues.data(), 1, viewingComm,
+          SyncInfo<Device::CPU>{} );
+        for( int q=0; q<viewingSize; ++q )
+            if( allQueues[q] )
+                queuingRanks.push_back( q );
+    }
+
+    const Int oldRoundSize = QueueRoundSize();
+    SetQueueRoundSize( roundSize );
+    if( queues )
+    {
+        QueueUpdates( A, viewingRank );
+        A.ProcessQueues( includeViewers );
+    }
+
+    // Every copy of each local entry must hold the combined updates
+    if( A.Participating() )
+    {
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                const T expected = ExpectedEntry<T>( i, j, queuingRanks );
+                if( A.GetLocal(iLoc,jLoc) != expected )
+                    LogicError
+                    ("Entry (",i,",",j,") was ",A.GetLocal(iLoc,jLoc),
+                     " instead of ",expected);
+            }
+        }
+    }
+
+    // Pull the entries back in a process-dependent order, including
+    // repeated requests for the same entry
+    if( queues )
+    {
+        vector<std::pair<Int,Int>> pulls;
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( Queues(i,j,viewingRank) || viewingRank == 0 )
+                    pulls.emplace_back( m-1-i, j );
+        for( Int k=0; k<Min(Int(pulls.size()),m); ++k )
+            pulls.push_back( pulls[k] );
+        A.ReservePulls( pulls.size() );
+        for( const auto& pull : pulls )
+            A.QueuePull( pull.first, pull.second );
+        vector<T> values;
+        A.ProcessPullQueue( values, includeViewers );
+        if( values.size() != pulls.size() )
+            LogicError
+            ("Pulled ",values.size()," entries instead of ",pulls.size());
+        for( size_t k=0; k<pulls.size(); ++k )
+        {
+            const Int i = pulls[k].first;
+            const Int j = pulls[k].second;
+            const T expected = ExpectedEntry<T>( i, j, queuingRanks );
+            if( values[k] != expected )
+                LogicError
+                ("Pulled ",values[k]," from (",i,",",j,") instead of ",
+                 expected);
+        }
+    }
+    SetQueueRoundSize( oldRoundSize );
+}
+
+template<typename T>
+void TestDistributions
+( const Grid& g, Int m, Int n, Int roundSize, bool includeViewers )
+{
+    TestQueues<T,MC,  MR  >( g, m, n, roundSize, includeViewers );
+    TestQueues<T,STAR,STAR>( g, m, n, roundSize, includeViewers );
+    TestQueues<T,MC,  STAR>( g, m, n, roundSize, includeViewers );
+    TestQueues<T,STAR,VR  >( g, m, n, roundSize, includeViewers );
+}
+
+template<typename T>
+void TestGrids( Int m, Int n, Int roundSize )
+{
+    mpi::Comm const& comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    // All processes own the matrices
+    const Grid g( mpi::NewWorldComm() );
+    TestDistributions<T>( g, m, n, roundSize, true );
+    TestDistributions<T>( g, m, n, roundSize, false );
+
+    // Only the first half of the processes own the matrices and the rest
+    // merely view them
+    const int numOwners = Max(commSize/2,1);
+    vector<int> ownerRanks(numOwners);
+    for( int q=0; q<numOwners; ++q )
+        ownerRanks[q] = q;
+    mpi::Group group, ownerGroup;
+    mpi::CommGroup( comm, group );
+    mpi::Incl( group, numOwners, ownerRanks.data(), ownerGroup );
+    const Grid viewedGrid
+    ( mpi::NewWorldComm(), ownerGroup, 1, COLUMN_MAJOR );
+    mpi::Free( group );
+    TestDistributions<T>( viewedGrid, m, n, roundSize, true );
+    TestDistributions<T>( viewedGrid, m, n, roundSize, false );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",21);
+        const Int n = Input("--n","width of matrix",13);
+        const Int roundSize = Input("--roundSize","updates per round",7);
+        ProcessInput();
+        PrintInputReport();
+
+        // A single round, then several
+        TestGrids<double>( m, n, m*n*4 );
+        TestGrids<double>( m, n, roundSize );
+        TestGrids<Complex<double>>( m, n, roundSize );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Fills A from a freshly seeded stream
+template<typename T>
+void Draw( AbstractDistMatrix<T>& A, Int m, Int n, bool gaussian )
+{
+    if( gaussian )
+        Gaussian( A, m, n );
+    else
+        Uniform( A, m, n );
+}
+
+template<typename T>
+void CheckIdentical
+( const AbstractDistMatrix<T>& A, const Matrix<T>& ref, const string& label )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    const auto& ALoc = A_STAR_STAR.LockedMatrix();
+    for( Int j=0; j<ref.Width(); ++j )
+        for( Int i=0; i<ref.Height(); ++i )
+            if( ALoc(i,j) != ref(i,j) )
+                LogicError
+                (label,": entry (",i,",",j,") was ",ALoc(i,j),
+                 " instead of ",ref(i,j));
+}
+
+template<typename T,Dist U,Dist V>
+void TestDistribution
+( const Grid& g, Int m, Int n, bool gaussian, const Matrix<T>& ref )
+{
+    InitializeRandom( true );
+    DistMatrix<T,U,V> A(g);
+    Draw( A, m, n, gaussian );
+    CheckIdentical
+    ( A, ref,
+      BuildString("[",DistToString(U),",",DistToString(V),"] on a ",
+                  g.Height()," x ",g.Width()," grid") );
+}
+
+template<typename T>
+void TestRandom( Int m, Int n, bool gaussian )
+{
+    mpi::Comm const& comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    OutputFromRoot
+    (comm,"Testing ",(gaussian ? "Gaussian" : "Uniform")," with ",
+     TypeName<T>());
+    PushIndent();
+
+    // The first two streams, drawn on the default grid
+    const Grid& defaultGrid = Grid::Default();
+    Matrix<T> ref, secondRef;
+    {
+        InitializeRandom( true );
+        DistMatrix<T,STAR,STAR> A(defaultGrid);
+        Draw( A, m, n, gaussian );
+        ref = A.Matrix();
+        Draw( A, m, n, gaussian );
+        secondRef = A.Matrix();
+    }
+
+    // Every grid shape and distribution yields the same entries
+    for( int height=1; height<=commSize; ++height )
+    {
+        if( commSize % height != 0 )
+            continue;
+        const Grid g( mpi::NewWorldComm(), height );
+        TestDistribution<T,MC,  MR  >( g, m, n, gaussian, ref );
+        TestDistribution<T,MR,  MC  >( g, m, n, gaussian, ref );
+        TestDistribution<T,MC,  STAR>( g, m, n, gaussian, ref );
+        TestDistribution<T,STAR,MR  >( g, m, n, gaussian, ref );
+        TestDistribution<T,VC,  STAR>( g, m, n, gaussian, ref );
+        TestDistribution<T,STAR,VR  >( g, m, n, gaussian, ref );
+        TestDistribution<T,CIRC,CIRC>( g, m, n, gaussian, ref );
+    }
+
+    // A draw on a grid over only part of the processes only advances the
+    // streams of that grid, so all of the processes still agree on the next
+    // streams of the default grid
+    InitializeRandom( true );
+    const int color = ( commRank < Max(commSize/2,1) ? 0 : 1 );
+    mpi::Comm subComm;
+    mpi::Split( comm, color, commRank, subComm );
+    if( color == 0 )
+    {
+        const Grid subGrid( std::move(subComm) );
+        DistMatrix<T> B(subGrid);
+        Draw( B, m, n, gaussian );
+    }
+    else
+        mpi::Free( subComm );
+    DistMatrix<T> A(defaultGrid);
+    Draw( A, m, n, gaussian );
+    CheckIdentical( A, ref, "After a draw on a subset of processes" );
+    Draw( A, m, n, gaussian );
+    CheckIdentical
+    ( A, secondRef, "Second draw after a draw on a subset of processes" );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",23);
+        ProcessInput();
+        PrintInputReport();
+
+        TestRandom<float>( m, n, false );
+        TestRandom<double>( m, n, false );
+        TestRandom<Complex<double>>( m, n, false );
+        TestRandom<float>( m, n, true );
+        TestRandom<double>( m, n, true );
+        TestRandom<Complex<double>>( m, n, true );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
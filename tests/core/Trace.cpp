@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <El/core/Profiling.hpp>
+using namespace El;
+
+void Begin( const char* desc )
+{ BeginRegionProfile( desc, Color::ROYAL_BLUE ); }
+
+void End( const char* desc )
+{ EndRegionProfile( desc ); }
+
+// Returns the number of calls of every region in the trace summary, which
+// is only printed on the root
+std::map<std::string,Int> SummaryCalls( mpi::Comm const& comm )
+{
+    std::ostringstream os;
+    PrintTraceSummary( os );
+    std::map<std::string,Int> calls;
+    if( mpi::Rank(comm) != 0 )
+        return calls;
+    std::istringstream summary( os.str() );
+    std::string line;
+    std::getline( summary, line );
+    while( std::getline( summary, line ) )
+    {
+        std::istringstream fields( line );
+        std::string name;
+        Int ranks, numCalls;
+        fields >> name >> ranks >> numCalls;
+        calls[name] = numCalls;
+    }
+    return calls;
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm const& comm = mpi::COMM_WORLD;
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        EnableRegionTracing();
+        ClearTrace();
+
+        // Properly nested regions
+        for( Int k=0; k<3; ++k )
+        {
+            Begin("TraceOuter");
+            Begin("TraceInner");
+            End("TraceInner");
+            End("TraceOuter");
+        }
+
+        // A region that began untraced encloses a traced one
+        DisableRegionTracing();
+        Begin("TraceUntracedOuter");
+        EnableRegionTracing();
+        Begin("TraceTracedInner");
+        End("TraceTracedInner");
+        End("TraceUntracedOuter");
+
+        // A region whose session ended before it did cannot be matched,
+        // and a region that begins and ends while disabled is not seen
+        Begin("TraceStale");
+        DisableRegionTracing();
+        Begin("TraceDisabled");
+        End("TraceDisabled");
+        EnableRegionTracing();
+        End("TraceStale");
+        Begin("TraceAfterStale");
+        End("TraceAfterStale");
+
+        // Reusing the storage of a description for another name must not
+        // alias the cached region
+        char desc[] = "TraceReusedA";
+        Begin(desc);
+        End(desc);
+        desc[sizeof(desc)-2] = 'B';
+        Begin(desc);
+        End(desc);
+
+        DisableRegionTracing();
+        // Regions are not recorded once tracing is disabled
+        Begin("TraceOuter");
+        End("TraceOuter");
+
+        auto calls = SummaryCalls( comm );
+        if( mpi::Rank(comm) == 0 )
+        {
+            const std::map<std::string,Int> expected =
+              { {"TraceOuter",3}, {"TraceInner",3}, {"TraceTracedInner",1},
+                {"TraceAfterStale",1}, {"TraceReusedA",1},
+                {"TraceReusedB",1}, {"TraceUntracedOuter",0},
+                {"TraceStale",0}, {"TraceDisabled",0} };
+            for( auto const& entry : expected )
+            {
+                auto it = calls.find( entry.first );
+                const Int numCalls = ( it == calls.end() ? 0 : it->second );
+                Output(entry.first,": ",numCalls," calls");
+                if( numCalls != entry.second*commSize )
+                    LogicError
+                    ("Expected ",entry.second*commSize," calls of ",
+                     entry.first," but found ",numCalls);
+            }
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -19,13 +19,13 @@ using namespace El;
  * @param uplo denotes whether to compute L or L^T
  * @param m the matrix dimension
  * @param nbLocal the local block size
- * @param scalapack flag indicating whether to test scalapack
+ * @param ctrl selects ScaLAPACK or the lookahead depth
  */
 template<typename F>
-void TestCholesky(const Grid& g, UpperOrLower uplo, Int m, Int nbLocal, bool scalapack)
+void TestCholesky(const Grid& g, UpperOrLower uplo, Int m, Int nbLocal, const CholeskyCtrl& ctrl)
 {   
     OutputFromRoot(g.Comm(),"Testing distributed Cholesky with ",TypeName<F>(), ",\nlocal block: ", nbLocal, ",\nmatrix size: ", m, 
-    ",\nProcessors: ", g.Size());
+    ",\nProcessors: ", g.Size(), ",\nlookahead: ", ctrl.lookahead);
 
     // initialize the matrix (currently to Identity)
     for (int i = 0; i < 6; i++) {
@@ -36,7 +36,7 @@ void TestCholesky(const Grid& g, UpperOrLower uplo, Int m, Int nbLocal, bool sca
         mpi::Barrier(g.Comm());
         Timer timer;
         timer.Start();
-        Cholesky(uplo, A, scalapack);
+        Cholesky(uplo, A, ctrl);
         mpi::Barrier( g.Comm() );
         const double runTime = timer.Stop() * 1000.0;
         if (i > 0) {
@@ -47,6 +47,49 @@ void TestCholesky(const Grid& g, UpperOrLower uplo, Int m, Int nbLocal, bool sca
     // print timing
 }
 
+/**
+ * @brief checks the factor of a random HPD matrix for several lookahead depths
+ *
+ * @param g the grid to run the factorization on
+ * @param uplo denotes whether to compute L or L^H
+ * @param m the matrix dimension
+ */
+template<typename F>
+void CheckCholesky(const Grid& g, UpperOrLower uplo, Int m)
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Checking Cholesky with ",TypeName<F>(),
+                   ", uplo=",(uplo == LOWER ? "L" : "U"));
+    PushIndent();
+
+    DistMatrix<F> A(g), U(g);
+    Uniform(U, m, m);
+    Zeros(A, m, m);
+    Herk(uplo, NORMAL, Real(1), U, Real(0), A);
+    ShiftDiagonal(A, F(m));
+    const Real ANorm = HermitianFrobeniusNorm(uplo, A);
+
+    for (Int lookahead : {0, 1, 2, 3})
+    {
+        CholeskyCtrl ctrl;
+        ctrl.lookahead = lookahead;
+        DistMatrix<F> L(A);
+        Cholesky(uplo, L, ctrl);
+        MakeTrapezoidal(uplo, L);
+
+        // A - L L^H (or A - U^H U) should be on the order of roundoff
+        DistMatrix<F> E(A);
+        Herk(uplo, (uplo == LOWER ? NORMAL : ADJOINT), Real(-1), L, Real(1), E);
+        const Real error = HermitianFrobeniusNorm(uplo, E) / ANorm;
+        const Real tol = Real(m)*limits::Epsilon<Real>();
+        OutputFromRoot(g.Comm(),"lookahead ",lookahead,": relative error ",
+                       error);
+        if (error > tol)
+            LogicError("Relative error of ",error," exceeded ",tol);
+    }
+    PopIndent();
+}
+
 int main(int argc, char* argv[])
 {
     // set up the enviroment and the MPI communicator 
@@ -61,6 +104,7 @@ int main(int argc, char* argv[])
         const Int m = Input("--m","height of matrix",1024);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int lookahead = Input("--lookahead","lookahead depth",0);
 #ifdef EL_HAVE_SCALAPACK
         const bool scalapack = Input("--scalapack","test ScaLAPACK?",false);
 #else
@@ -81,7 +125,16 @@ int main(int argc, char* argv[])
         SetBlocksize(nb);
 
         // run cholesky factorization on all ranks
-        TestCholesky<double>(g, uplo, m, nbLocal, scalapack);
+        CholeskyCtrl ctrl;
+        ctrl.scalapack = scalapack;
+        ctrl.lookahead = lookahead;
+        TestCholesky<double>(g, uplo, m, nbLocal, ctrl);
+
+        // verify the factors, including those of every lookahead depth
+        CheckCholesky<double>(g, LOWER, m);
+        CheckCholesky<double>(g, UPPER, m);
+        CheckCholesky<Complex<double>>(g, LOWER, m);
+        CheckCholesky<Complex<double>>(g, UPPER, m);
     
     } catch(exception &e) {
         // report exception if one occured
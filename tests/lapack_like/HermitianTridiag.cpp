@@ -53,7 +53,7 @@ void TestCorrectness
     // Compare the appropriate triangle of AOrig and B
     MakeTrapezoidal( uplo, AOrig );
     MakeTrapezoidal( uplo, B );
-    B -= AOrig;
+    Axpy( Field(-1), AOrig, B );
     if( print )
         Print( B, "Error in rotated tridiagonal" );
     if( display )
@@ -69,7 +69,7 @@ void TestCorrectness
     Adjoint( B, QHAdj );
     MakeIdentity( B );
     herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, B );
-    QHAdj -= B;
+    Axpy( Field(-1), B, QHAdj );
     herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
     ShiftDiagonal( B, Field(-1) );
     const Real infOrthogError = InfinityNorm( B );
@@ -164,6 +164,143 @@ void TestCorrectness
         LogicError("Relative orthogonality error was unacceptably large");
 }
 
+// The two-stage reduction only provides the application of Q from the left, so
+// Q T Q^H is formed as Q (Q T)^H
+template<typename Field>
+void TestTwoStageCorrectness
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const herm_tridiag::BandReflectors<Field>& bandReflectors,
+        Matrix<Field>& AOrig,
+  bool print,
+  bool display )
+{
+    typedef Base<Field> Real;
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = HermitianOneNorm( LOWER, AOrig );
+
+    Output("Testing error...");
+    PushIndent();
+
+    auto d = GetRealPartOfDiagonal(A);
+    auto e = GetRealPartOfDiagonal(A,-1);
+
+    Matrix<Field> B;
+    Zeros( B, m, m );
+    SetRealPartOfDiagonal( B, d );
+    SetRealPartOfDiagonal( B, e, -1 );
+    SetRealPartOfDiagonal( B, e,  1 );
+    if( print )
+        Print( B, "Tridiagonal" );
+    if( display )
+        Display( B, "Tridiagonal" );
+
+    Matrix<Field> C;
+    herm_tridiag::ApplyQ( NORMAL, A, householderScalars, bandReflectors, B );
+    Adjoint( B, C );
+    herm_tridiag::ApplyQ( NORMAL, A, householderScalars, bandReflectors, C );
+    if( print )
+        Print( C, "Rotated tridiagonal" );
+    if( display )
+        Display( C, "Rotated tridiagonal" );
+
+    MakeTrapezoidal( LOWER, AOrig );
+    MakeTrapezoidal( LOWER, C );
+    Axpy( Field(-1), AOrig, C );
+    if( print )
+        Print( C, "Error in rotated tridiagonal" );
+    if( display )
+        Display( C, "Error in rotated tridiagonal" );
+    const Real infError = HermitianInfinityNorm( LOWER, C );
+    const Real relError = infError / (eps*m*oneNormA);
+    Output("||A - Q T Q^H||_oo / (eps m ||A||_1) = ",relError);
+
+    MakeIdentity( B );
+    herm_tridiag::ApplyQ( NORMAL, A, householderScalars, bandReflectors, B );
+    herm_tridiag::ApplyQ( ADJOINT, A, householderScalars, bandReflectors, B );
+    ShiftDiagonal( B, Field(-1) );
+    const Real infOrthogError = InfinityNorm( B );
+    const Real relOrthogError = infOrthogError / (eps*m);
+    Output("||I - Q^H Q||_oo / (eps m) = ",relOrthogError);
+
+    PopIndent();
+
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably large");
+    if( relOrthogError > Real(10) )
+        LogicError("Relative orthogonality error was unacceptably large");
+}
+
+template<typename Field>
+void TestTwoStageCorrectness
+( const DistMatrix<Field>& A,
+  const DistMatrix<Field,STAR,STAR>& householderScalars,
+  const herm_tridiag::BandReflectors<Field>& bandReflectors,
+        DistMatrix<Field>& AOrig,
+  bool print,
+  bool display )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = HermitianOneNorm( LOWER, AOrig );
+
+    OutputFromRoot(grid.Comm(),"Testing error...");
+    PushIndent();
+
+    auto d = GetRealPartOfDiagonal(A);
+    auto e = GetRealPartOfDiagonal(A,-1);
+
+    DistMatrix<Field> B(grid);
+    B.AlignWith( A );
+    Zeros( B, m, m );
+    SetRealPartOfDiagonal( B, d );
+    SetRealPartOfDiagonal( B, e, -1 );
+    SetRealPartOfDiagonal( B, e,  1 );
+    if( print )
+        Print( B, "Tridiagonal" );
+    if( display )
+        Display( B, "Tridiagonal" );
+
+    DistMatrix<Field> C(grid);
+    herm_tridiag::ApplyQ( NORMAL, A, householderScalars, bandReflectors, B );
+    Adjoint( B, C );
+    herm_tridiag::ApplyQ( NORMAL, A, householderScalars, bandReflectors, C );
+    if( print )
+        Print( C, "Rotated tridiagonal" );
+    if( display )
+        Display( C, "Rotated tridiagonal" );
+
+    MakeTrapezoidal( LOWER, AOrig );
+    MakeTrapezoidal( LOWER, C );
+    C -= AOrig;
+    if( print )
+        Print( C, "Error in rotated tridiagonal" );
+    if( display )
+        Display( C, "Error in rotated tridiagonal" );
+    const Real infError = HermitianInfinityNorm( LOWER, C );
+    const Real relError = infError / (eps*m*oneNormA);
+    OutputFromRoot
+    (grid.Comm(),"||A - Q T Q^H||_oo / (eps m ||A||_1) = ",relError);
+
+    MakeIdentity( B );
+    herm_tridiag::ApplyQ( NORMAL, A, householderScalars, bandReflectors, B );
+    herm_tridiag::ApplyQ( ADJOINT, A, householderScalars, bandReflectors, B );
+    ShiftDiagonal( B, Field(-1) );
+    const Real infOrthogError = InfinityNorm( B );
+    const Real relOrthogError = infOrthogError / (eps*m);
+    OutputFromRoot(grid.Comm(),"||I - Q^H Q||_oo / (eps m) = ",relOrthogError);
+
+    PopIndent();
+
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably large");
+    if( relOrthogError > Real(10) )
+        LogicError("Relative orthogonality error was unacceptably large");
+}
+
 template<typename Field>
 void InnerTestHermitianTridiag
 ( UpperOrLower uplo,
@@ -242,10 +379,116 @@ void InnerTestHermitianTridiag
     A = ACopy;
 }
 
+template<typename Field>
+void InnerTestTwoStage
+(       Matrix<Field>& A,
+  Int bandwidth,
+  bool correctness,
+  bool print,
+  bool display )
+{
+    Matrix<Field> AOrig( A ), ACopy( A );
+    Matrix<Field> householderScalars;
+    herm_tridiag::BandReflectors<Field> bandReflectors;
+    const Int m = A.Height();
+    Timer timer;
+
+    Output("Starting tridiagonalization...");
+    timer.Start();
+    herm_tridiag::TwoStage( A, householderScalars, bandReflectors, bandwidth );
+    const double runTime = timer.Stop();
+    const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
+    Output(runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( A, "A after TwoStage" );
+    if( display )
+        Display( A, "A after TwoStage" );
+    if( correctness )
+        TestTwoStageCorrectness
+        ( A, householderScalars, bandReflectors, AOrig, print, display );
+    A = ACopy;
+}
+
+template<typename Field>
+void InnerTestTwoStage
+(       DistMatrix<Field>& A,
+  Int bandwidth,
+  bool correctness,
+  bool print,
+  bool display )
+{
+    DistMatrix<Field> AOrig( A ), ACopy( A );
+    const Int m = A.Height();
+    const Grid& grid = A.Grid();
+    DistMatrix<Field,STAR,STAR> householderScalars(grid);
+    herm_tridiag::BandReflectors<Field> bandReflectors;
+    Timer timer;
+
+    OutputFromRoot(grid.Comm(),"Starting tridiagonalization...");
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    herm_tridiag::TwoStage( A, householderScalars, bandReflectors, bandwidth );
+    mpi::Barrier( grid.Comm() );
+    const double runTime = timer.Stop();
+    const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
+    OutputFromRoot(grid.Comm(),runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( A, "A after TwoStage" );
+    if( display )
+        Display( A, "A after TwoStage" );
+    if( correctness )
+        TestTwoStageCorrectness
+        ( A, householderScalars, bandReflectors, AOrig, print, display );
+    A = ACopy;
+}
+
+// The two-stage approach of ExplicitCondensed must yield the tridiagonal
+// matrix of TwoStage in both triangles, with zeros elsewhere
+template<typename Field>
+void TestTwoStageCondensed
+( UpperOrLower uplo,
+  const DistMatrix<Field>& AOrig,
+  Int bandwidth )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = AOrig.Grid();
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    HermitianTridiagCtrl<Field> ctrl;
+    ctrl.approach = HERMITIAN_TRIDIAG_TWO_STAGE;
+    ctrl.bandwidth = bandwidth;
+    DistMatrix<Field> T( AOrig );
+    herm_tridiag::ExplicitCondensed( uplo, T, ctrl );
+
+    DistMatrix<Field> ARef( AOrig );
+    DistMatrix<Field,STAR,STAR> householderScalars(grid);
+    herm_tridiag::BandReflectors<Field> bandReflectors;
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, ARef );
+    herm_tridiag::TwoStage
+    ( ARef, householderScalars, bandReflectors, bandwidth );
+
+    // Clear the first-stage reflectors and restore both triangles
+    MakeTrapezoidal( UPPER, ARef, -1 );
+    MakeHermitian( LOWER, ARef );
+    const Real frobT = FrobeniusNorm( T );
+    T -= ARef;
+    const Real relError = FrobeniusNorm( T ) / (eps*m*frobT);
+    OutputFromRoot
+    (grid.Comm(),"Two-stage condensed ||T - T_ref||_F / (eps m ||T||_F) = ",
+     relError);
+    if( relError > Real(1) )
+        LogicError("The condensed two-stage matrix was incorrect");
+}
+
 template<typename Field>
 void TestHermitianTridiag
 ( UpperOrLower uplo,
   Int m,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -267,6 +510,12 @@ void TestHermitianTridiag
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, correctness, print, display );
 
+    if( uplo == LOWER )
+    {
+        Output("Two-stage algorithm:");
+        InnerTestTwoStage( A, bandwidth, correctness, print, display );
+    }
+
     PopIndent();
 }
 
@@ -277,6 +526,7 @@ void TestHermitianTridiag
   Int m,
   Int nbLocal,
   bool avoidTrmv,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -314,6 +564,20 @@ void TestHermitianTridiag
     ctrl.order = COLUMN_MAJOR;
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, ctrl, correctness, print, display );
+
+    OutputFromRoot(grid.Comm(),"Two-stage approach (one-stage fallback):");
+    ctrl.approach = HERMITIAN_TRIDIAG_TWO_STAGE;
+    ctrl.bandwidth = bandwidth;
+    InnerTestHermitianTridiag
+    ( uplo, A, householderScalars, ctrl, correctness, print, display );
+    if( correctness )
+        TestTwoStageCondensed( uplo, A, bandwidth );
+
+    if( uplo == LOWER )
+    {
+        OutputFromRoot(grid.Comm(),"Two-stage algorithm:");
+        InnerTestTwoStage( A, bandwidth, correctness, print, display );
+    }
     PopIndent();
 }
 
@@ -321,7 +585,7 @@ int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    mpi::Comm comm = mpi::NewWorldComm();
 
     try
     {
@@ -331,6 +595,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",75);
         const Int nb = Input("--nb","algorithmic blocksize",32);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for nb)",5);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv local Symv",true);
         const bool sequential = Input("--sequential","test sequential?",true);
@@ -353,7 +619,7 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
-        const Grid grid( comm, gridHeight, order );
+        const Grid grid( std::move(comm), gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
 
@@ -364,95 +630,106 @@ main( int argc, char* argv[] )
         {
             if( testReal )
                 TestHermitianTridiag<float>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<float>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
             if( testReal )
                 TestHermitianTridiag<double>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<double>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
 #ifdef EL_HAVE_QD
             if( testReal )
             {
                 TestHermitianTridiag<DoubleDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<QuadDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
             if( testCpx )
             {
                 TestHermitianTridiag<Complex<DoubleDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<Complex<QuadDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
 #endif
 
 #ifdef EL_HAVE_QUAD
             if( testReal )
                 TestHermitianTridiag<Quad>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<Quad>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
             if( testReal )
                 TestHermitianTridiag<BigFloat>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
         }
 
         if( testReal )
             TestHermitianTridiag<float>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<float>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
         if( testReal )
             TestHermitianTridiag<double>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
 #ifdef EL_HAVE_QD
         if( testReal )
         {
             TestHermitianTridiag<DoubleDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<QuadDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
         if( testCpx )
         {
             TestHermitianTridiag<Complex<DoubleDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<Complex<QuadDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
 #endif
 
 #ifdef EL_HAVE_QUAD
         if( testReal )
             TestHermitianTridiag<Quad>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<Quad>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         if( testReal )
             TestHermitianTridiag<BigFloat>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -82,7 +82,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -208,6 +208,12 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+    {
+        LUCtrl ctrl;
+        ctrl.tournament = true;
+        LU( A, P, ctrl );
+    }
     mpi::Barrier( grid.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -252,7 +258,7 @@ int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    mpi::Comm comm = mpi::NewWorldComm();
 
     try
     {
@@ -261,6 +267,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const bool tournament = Input
+            ("--tournament","also test tournament pivoting?",true);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
@@ -282,7 +290,7 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
-        const Grid grid( comm, gridHeight, order );
+        const Grid grid( std::move(comm), gridHeight, order );
         SetBlocksize( nb );
         ComplainIfDebug();
         if( pivot == 0 )
@@ -331,41 +339,51 @@ main( int argc, char* argv[] )
 #endif
         }
 
-        TestLU<float>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<float>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        // Tournament pivoting is a distributed variant of partial pivoting
+        const Int numDistRuns = ( pivot == 1 && tournament ? 2 : 1 );
+        for( Int run=0; run<numDistRuns; ++run )
+        {
+            const Int distPivot = ( run == 0 ? pivot : 3 );
+            if( run == 1 )
+                OutputFromRoot
+                (grid.Comm(),"Testing LU with tournament pivoting");
+
+            TestLU<float>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
+            TestLU<Complex<float>>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
 
-        TestLU<double>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<double>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+            TestLU<double>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
+            TestLU<Complex<double>>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
 
 #ifdef EL_HAVE_QD
-        TestLU<DoubleDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<QuadDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-
-        TestLU<Complex<DoubleDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<QuadDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+            TestLU<DoubleDouble>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
+            TestLU<QuadDouble>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
+
+            TestLU<Complex<DoubleDouble>>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
+            TestLU<Complex<QuadDouble>>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestLU<Quad>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<Quad>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+            TestLU<Quad>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
+            TestLU<Complex<Quad>>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestLU<BigFloat>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<BigFloat>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+            TestLU<BigFloat>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
+            TestLU<Complex<BigFloat>>
+            ( grid, m, distPivot, correctness, forceGrowth, print );
 #endif
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Forms A = U U^H + shift I, where U is m x k with uniformly random entries.
+// A small shift with k < m yields a badly conditioned matrix.
+template<typename Field>
+void MakeHPD( DistMatrix<Field>& A, Int m, Int k, Base<Field> shift )
+{
+    DistMatrix<Field> U(A.Grid());
+    Uniform( U, m, k );
+    Zeros( A, m, m );
+    Gemm( NORMAL, ADJOINT, Field(1), U, U, Field(0), A );
+    ShiftDiagonal( A, Field(shift) );
+}
+
+template<typename Field>
+void MakeHPD( Matrix<Field>& A, Int m, Int k, Base<Field> shift )
+{
+    Matrix<Field> U;
+    Uniform( U, m, k );
+    Zeros( A, m, m );
+    Gemm( NORMAL, ADJOINT, Field(1), U, U, Field(0), A );
+    ShiftDiagonal( A, Field(shift) );
+}
+
+// Solves a system with the sequential interface on every process. A and B
+// are scaled by scale, which forces a fallback if it overflows in single
+// precision.
+template<typename Field>
+void TestSequentialMixedPrecisionHPDSolve
+( const Grid& g, UpperOrLower uplo, Orientation orientation,
+  Int m, Int numRHS, Base<Field> scale, bool expectFallback )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing sequential solve with ",TypeName<Field>(),
+     ", scale=",scale);
+    PushIndent();
+
+    Matrix<Field> A, B, X;
+    MakeHPD( A, m, m, Real(m) );
+    Uniform( B, m, numRHS );
+    Scale( scale, A );
+    Scale( scale, B );
+    X = B;
+
+    auto info = MixedPrecisionHPDSolve( uplo, orientation, A, X );
+    if( orientation == TRANSPOSE )
+        Conjugate( A );
+    Matrix<Field> R( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    const Real error =
+      FrobeniusNorm(R) /
+      ( FrobeniusNorm(A)*FrobeniusNorm(X) + FrobeniusNorm(B) );
+    const Real tol = Sqrt(Real(m))*limits::Epsilon<Real>();
+    OutputFromRoot
+    (g.Comm(),info.numRefineIts," refinement its, backward error: ",error,
+     (info.usedFallback ? " (fell back)" : ""));
+    if( !info.converged || error > tol )
+        LogicError("Backward error of ",error," exceeded ",tol);
+    if( info.usedFallback != expectFallback )
+        LogicError
+        ("Expected the solve to ",(expectFallback ? "" : "not "),
+         "fall back to a full-precision factorization");
+    PopIndent();
+}
+
+template<typename Field>
+void TestMixedPrecisionHPDSolve
+( const Grid& g, UpperOrLower uplo, Orientation orientation,
+  Int m, Int numRHS, Int k, Base<Field> shift, bool expectFallback )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing with ",TypeName<Field>(),", k=",k,", shift=",shift);
+    PushIndent();
+
+    DistMatrix<Field> A(g), B(g), X(g);
+    MakeHPD( A, m, k, shift );
+    Uniform( B, m, numRHS );
+    X = B;
+
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    auto info = MixedPrecisionHPDSolve( uplo, orientation, A, X );
+    mpi::Barrier( g.Comm() );
+    const double runTime = timer.Stop();
+    OutputFromRoot
+    (g.Comm(),runTime," seconds, ",info.numRefineIts," refinement its, ",
+     "backward error: ",info.backwardError,
+     (info.usedFallback ? " (fell back)" : ""));
+
+    // Check the backward error independently of the routine
+    if( orientation == TRANSPOSE )
+        Conjugate( A );
+    DistMatrix<Field> R( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    const Real error =
+      FrobeniusNorm(R) /
+      ( FrobeniusNorm(A)*FrobeniusNorm(X) + FrobeniusNorm(B) );
+    const Real tol = Sqrt(Real(m))*limits::Epsilon<Real>();
+    OutputFromRoot(g.Comm(),"|| B - A X ||_F / (|| A ||_F || X ||_F + "
+                   "|| B ||_F) = ",error);
+    if( !info.converged || error > tol )
+        LogicError("Backward error of ",error," exceeded ",tol);
+    if( info.usedFallback != expectFallback )
+        LogicError
+        ("Expected the solve to ",(expectFallback ? "" : "not "),
+         "fall back to a full-precision factorization");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const char orientChar =
+          Input("--orient","orientation of A: N/T/C",'N');
+        const Int m = Input("--m","height of matrix",200);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( std::move(comm), gridHeight );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        const Orientation orientation = CharToOrientation( orientChar );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        // Well-conditioned systems are refined to double-precision accuracy
+        TestMixedPrecisionHPDSolve<double>
+        ( g, uplo, orientation, m, numRHS, m, double(m), false );
+        TestMixedPrecisionHPDSolve<Complex<double>>
+        ( g, uplo, orientation, m, numRHS, m, double(m), false );
+
+        // Systems that are too badly conditioned for single precision fall
+        // back to a double-precision factorization
+        TestMixedPrecisionHPDSolve<double>
+        ( g, uplo, orientation, m, numRHS, m/2, 1e-10, true );
+        TestMixedPrecisionHPDSolve<Complex<double>>
+        ( g, uplo, orientation, m, numRHS, m/2, 1e-10, true );
+
+        // The sequential interface, including systems whose entries would
+        // overflow in single precision
+        TestSequentialMixedPrecisionHPDSolve<double>
+        ( g, uplo, orientation, m, numRHS, 1., false );
+        TestSequentialMixedPrecisionHPDSolve<Complex<double>>
+        ( g, uplo, orientation, m, numRHS, 1., false );
+        TestSequentialMixedPrecisionHPDSolve<double>
+        ( g, uplo, orientation, m, numRHS, 1e60, true );
+        TestSequentialMixedPrecisionHPDSolve<Complex<double>>
+        ( g, uplo, orientation, m, numRHS, 1e60, true );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
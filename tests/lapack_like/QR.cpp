@@ -37,7 +37,7 @@ void TestCorrectness
     // Form X := I - Q^H Q
     Matrix<Field> X;
     Identity( X, minDim, minDim );
-    X -= ZUpper;
+    Axpy( Field(-1), ZUpper, X );
 
     const Real infOrthogError = InfinityNorm( X );
     const Real relOrthogError = infOrthogError / (eps*maxDim);
@@ -51,7 +51,7 @@ void TestCorrectness
     auto U( A );
     MakeTrapezoidal( UPPER, U );
     qr::ApplyQ( LEFT, NORMAL, A, householderScalars, d, U );
-    U -= AOrig;
+    Axpy( Field(-1), AOrig, U );
     const Real infError = InfinityNorm( U );
     const Real relError = infError / (eps*maxDim*oneNormA);
     Output("||A - Q R||_oo / (eps Max(m,n) ||A||_1) = ",relError);
@@ -169,10 +169,18 @@ void TestQR
 ( const Grid& grid,
   Int m,
   Int n,
+  bool communicationAvoiding,
+  TSQRTree tree,
   bool correctness,
   bool print )
 {
-    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    if( communicationAvoiding )
+        OutputFromRoot
+        (grid.Comm(),"Testing CAQR (",
+         (tree==TSQR_BINARY_TREE ? "binary" : "flat")," tree) with ",
+         TypeName<Field>());
+    else
+        OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
     PushIndent();
     DistMatrix<Field> A(grid), AOrig(grid);
     DistMatrix<Field,MD,STAR> householderScalars(grid);
@@ -189,7 +197,10 @@ void TestQR
     OutputFromRoot(grid.Comm(),"Starting QR factorization...");
     mpi::Barrier( grid.Comm() );
     const double startTime = mpi::Time();
-    QR( A, householderScalars, signature );
+    if( communicationAvoiding )
+        qr::CA( A, householderScalars, signature, tree );
+    else
+        QR( A, householderScalars, signature );
     mpi::Barrier( grid.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
@@ -211,7 +222,7 @@ int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    mpi::Comm comm = mpi::NewWorldComm();
 
     try
     {
@@ -221,6 +232,7 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",64);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool caqr = Input("--caqr","test CAQR?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
 #ifdef EL_HAVE_MPC
@@ -237,7 +249,7 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
-        const Grid grid( comm, gridHeight, order );
+        const Grid grid( std::move(comm), gridHeight, order );
         SetBlocksize( nb );
         ComplainIfDebug();
 
@@ -280,41 +292,49 @@ main( int argc, char* argv[] )
 #endif
         }
 
-        TestQR<float>
-        ( grid, m, n, correctness, print );
-        TestQR<Complex<float>>
-        ( grid, m, n, correctness, print );
+        // Variant 0 is the standard Householder QR and variants 1 and 2 are
+        // CAQR with binary and flat TSQR trees
+        const int numVariants = ( caqr ? 3 : 1 );
+        for( int variant=0; variant<numVariants; ++variant )
+        {
+            const TSQRTree tree =
+              ( variant == 2 ? TSQR_FLAT_TREE : TSQR_BINARY_TREE );
+            TestQR<float>
+            ( grid, m, n, variant>0, tree, correctness, print );
+            TestQR<Complex<float>>
+            ( grid, m, n, variant>0, tree, correctness, print );
 
-        TestQR<double>
-        ( grid, m, n, correctness, print );
-        TestQR<Complex<double>>
-        ( grid, m, n, correctness, print );
+            TestQR<double>
+            ( grid, m, n, variant>0, tree, correctness, print );
+            TestQR<Complex<double>>
+            ( grid, m, n, variant>0, tree, correctness, print );
 
 #ifdef EL_HAVE_QD
-        TestQR<DoubleDouble>
-        ( grid, m, n, correctness, print );
-        TestQR<QuadDouble>
-        ( grid, m, n, correctness, print );
-
-        TestQR<Complex<DoubleDouble>>
-        ( grid, m, n, correctness, print );
-        TestQR<Complex<QuadDouble>>
-        ( grid, m, n, correctness, print );
+            TestQR<DoubleDouble>
+            ( grid, m, n, variant>0, tree, correctness, print );
+            TestQR<QuadDouble>
+            ( grid, m, n, variant>0, tree, correctness, print );
+
+            TestQR<Complex<DoubleDouble>>
+            ( grid, m, n, variant>0, tree, correctness, print );
+            TestQR<Complex<QuadDouble>>
+            ( grid, m, n, variant>0, tree, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestQR<Quad>
-        ( grid, m, n, correctness, print );
-        TestQR<Complex<Quad>>
-        ( grid, m, n, correctness, print );
+            TestQR<Quad>
+            ( grid, m, n, variant>0, tree, correctness, print );
+            TestQR<Complex<Quad>>
+            ( grid, m, n, variant>0, tree, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestQR<BigFloat>
-        ( grid, m, n, correctness, print );
-        TestQR<Complex<BigFloat>>
-        ( grid, m, n, correctness, print );
+            TestQR<BigFloat>
+            ( grid, m, n, variant>0, tree, correctness, print );
+            TestQR<Complex<BigFloat>>
+            ( grid, m, n, variant>0, tree, correctness, print );
 #endif
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Forms A = X diag(sigma) Y^H, where X and Y have orthonormal columns and the
+// singular values, sigma, decay geometrically by the given ratio
+template<typename Field>
+void MakeDecaying
+( DistMatrix<Field>& A, DistMatrix<Base<Field>,STAR,STAR>& sigma,
+  Int m, Int n, Base<Field> ratio )
+{
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int minDim = Min(m,n);
+    DistMatrix<Field> X(g), Y(g);
+    Gaussian( X, m, minDim );
+    Gaussian( Y, n, minDim );
+    qr::ExplicitUnitary( X );
+    qr::ExplicitUnitary( Y );
+
+    sigma.Resize( minDim, 1 );
+    Real sigmaVal = 1;
+    for( Int i=0; i<minDim; ++i )
+    {
+        sigma.Set( i, 0, sigmaVal );
+        sigmaVal *= ratio;
+    }
+    DiagonalScale( RIGHT, NORMAL, sigma, X );
+    Gemm( NORMAL, ADJOINT, Field(1), X, Y, A );
+}
+
+template<typename Field>
+void TestRandomizedSVD
+( const Grid& g, Int m, Int n, Int rank, Int oversample,
+  const RangeFinderCtrl& ctrl, bool print )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing with ",TypeName<Field>(),", ",
+     (ctrl.sketch==GAUSSIAN_SKETCH ? "Gaussian" : "Rademacher")," sketch and ",
+     ctrl.numPowerIts," power iterations");
+    PushIndent();
+
+    const Real ratio = Real(0.7);
+    DistMatrix<Field> A(g), U(g), V(g);
+    DistMatrix<Real,STAR,STAR> sigma(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    MakeDecaying( A, sigma, m, n, ratio );
+
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    RandomizedSVD( A, U, s, V, rank, oversample, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),timer.Stop()," seconds");
+    if( print )
+    {
+        Print( U, "U" );
+        Print( s, "s" );
+        Print( V, "V" );
+    }
+
+    // The best rank-k approximation has error sigma_{k+1} in the
+    // two-norm, which we bound with the Frobenius norm of its tail
+    Real optimalError = 0;
+    for( Int i=rank; i<Min(m,n); ++i )
+        optimalError += sigma.Get(i,0)*sigma.Get(i,0);
+    optimalError = Sqrt(optimalError);
+
+    DistMatrix<Field> E( A ), UScaled( U );
+    DiagonalScale( RIGHT, NORMAL, s, UScaled );
+    Gemm( NORMAL, ADJOINT, Field(-1), UScaled, V, Field(1), E );
+    const Real error = FrobeniusNorm( E );
+    OutputFromRoot
+    (g.Comm(),"|| A - U diag(s) V^H ||_F = ",error,
+     " (optimal: ",optimalError,")");
+
+    // Orthonormality of the computed singular vectors
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<Field> Z(g);
+    Identity( Z, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), U, Real(1), Z );
+    Real orthogError = HermitianFrobeniusNorm( LOWER, Z );
+    Identity( Z, rank, rank );
+    Herk( LOWER, ADJOINT, Real(-1), V, Real(1), Z );
+    orthogError = Max( orthogError, HermitianFrobeniusNorm( LOWER, Z ) );
+    OutputFromRoot(g.Comm(),"max(|| I - U^H U ||_F, || I - V^H V ||_F) = ",
+                   orthogError);
+
+    // The leading singular values should be accurate
+    Real valueError = 0;
+    for( Int i=0; i<rank; ++i )
+        valueError =
+          Max( valueError, Abs(s.Get(i,0)-sigma.Get(i,0))/sigma.Get(i,0) );
+    OutputFromRoot
+    (g.Comm(),"max_i |s_i - sigma_i| / sigma_i = ",valueError);
+
+    if( error > 10*optimalError )
+        LogicError("Approximation error was unacceptably large");
+    if( orthogError > 100*Sqrt(Real(Max(m,n)))*eps )
+        LogicError("Singular vectors were not orthonormal");
+    if( ctrl.numPowerIts > 0 && valueError > Real(0.01) )
+        LogicError("Singular values were unacceptably inaccurate");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        const Int m = Input("--m","height of matrix",300);
+        const Int n = Input("--n","width of matrix",200);
+        const Int rank = Input("--rank","rank of approximation",10);
+        const Int oversample = Input("--oversample","oversampling",10);
+        const Int numPowerIts = Input("--numPowerIts","power iterations",2);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( std::move(comm), gridHeight );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        RangeFinderCtrl ctrl;
+        for( Int its : { Int(0), numPowerIts } )
+        {
+            ctrl.numPowerIts = its;
+            ctrl.sketch = GAUSSIAN_SKETCH;
+            TestRandomizedSVD<double>( g, m, n, rank, oversample, ctrl, print );
+            TestRandomizedSVD<Complex<double>>
+            ( g, m, n, rank, oversample, ctrl, print );
+            ctrl.sketch = RADEMACHER_SKETCH;
+            TestRandomizedSVD<double>( g, m, n, rank, oversample, ctrl, print );
+            TestRandomizedSVD<Complex<double>>
+            ( g, m, n, rank, oversample, ctrl, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}